@@ -0,0 +1,58 @@
+/**
+ * @file compound_parse.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Measures how long it takes to parse a compound option with a million
+ * values (file paths), which is dominated by checking whether every value is
+ * the name of another option.
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <input_parser/parser.hpp>
+
+int main() {
+  constexpr int kValues = 1'000'000;
+  constexpr int kRepetitions = 5;
+
+  std::vector<std::string> storage = {"benchmark", "--inputs"};
+  for (int value = 0; value < kValues; ++value) {
+    storage.push_back("/data/input_" + std::to_string(value) + ".csv");
+  }
+  storage.emplace_back("--verbose");
+  std::vector<char *> argv;
+  for (auto &argument : storage) argv.push_back(argument.data());
+
+  auto best = std::chrono::nanoseconds::max();
+  for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+    auto parser = input_parser::Parser()
+                    .addOption([] {
+                      return input_parser::CompoundOption("-i", "--inputs");
+                    })
+                    .addOption([] {
+                      return input_parser::FlagOption("-v", "--verbose")
+                        .addDefaultValue(false);
+                    });
+    const auto start = std::chrono::steady_clock::now();
+    const auto result =
+      parser.tryParse(static_cast<unsigned int>(argv.size()), argv.data());
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    if (!result) {
+      std::fputs(result.error().what(), stderr);
+      return 1;
+    }
+    best = std::min(best, elapsed);
+  }
+  std::printf(
+    "%d values parsed in %.2f ms\n", kValues,
+    std::chrono::duration<double, std::milli>(best).count()
+  );
+  return 0;
+}
\ No newline at end of file
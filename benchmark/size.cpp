@@ -0,0 +1,68 @@
+/**
+ * @file size.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief A small command line program used to measure how much code the
+ * parser adds to a binary. When INPUT_PARSER_SIZE_BASELINE is defined the
+ * parser is not used, so the difference between both binaries is the size
+ * of the parser.
+ *
+ */
+
+#include <cstdio>
+
+#ifndef INPUT_PARSER_SIZE_BASELINE
+#include <input_parser/parser.hpp>
+#endif
+
+int main(int argc, char *argv[]) {
+#ifdef INPUT_PARSER_SIZE_BASELINE
+  for (int index = 1; index < argc; ++index) std::puts(argv[index]);
+  return 0;
+#else
+  auto parser = input_parser::Parser()
+                  .addHelpOption()
+                  .addOption([] {
+                    return input_parser::FlagOption("-v", "--verbose")
+                      .addDescription("Shows every step")
+                      .addDefaultValue(false);
+                  })
+                  .addOption([] {
+                    return input_parser::SingleOption("-j", "--jobs")
+                      .addDescription("Amount of jobs")
+                      .addDefaultValue(std::string("1"))
+                      .toInt()
+                      .transformBeforeCheck()
+                      .addConstraint<int>(
+                        [](const int &jobs) { return jobs > 0; },
+                        "There must be at least one job"
+                      );
+                  })
+                  .addOption([] {
+                    return input_parser::CompoundOption("-w", "--weights")
+                      .addDescription("Weight of every input")
+                      .toDouble();
+                  })
+                  .addOption([] {
+                    return input_parser::CompoundOption("-i", "--inputs")
+                      .addDescription("The files to read");
+                  });
+  if (auto result = parser.tryParse(argc, argv); !result) {
+    std::fputs(result.error().what(), stderr);
+    std::fputc('\n', stderr);
+    return 1;
+  }
+  const auto jobs = parser.getValue<int>("-j");
+  const auto weights = parser.getValue<std::vector<double>>("-w");
+  const auto inputs = parser.getValue<std::vector<std::string>>("-i");
+  if (parser.getValue<bool>("-v")) {
+    std::printf(
+      "%d jobs, %zu weights, %zu inputs\n", jobs, weights.size(), inputs.size()
+    );
+  }
+  return 0;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**
+ * @file chain.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a chain of transformations.
+ *   The stages of a chain are composed at compile time into a single
+ * callable, so the value goes from one stage to the next with its own type.
+ * Only the whole chain is stored as a std::any transformation once it is
+ * given to an option.
+ *
+ */
+
+#ifndef _INPUT_CHAIN_HPP_
+#define _INPUT_CHAIN_HPP_
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace input_parser {
+
+namespace detail {
+
+/** @brief A stage that calls the second function with the first one's result */
+template <class First, class Second>
+struct ComposedStage {
+  // The stage called first
+  First first;
+  // The stage that receives the result of the first one
+  Second second;
+
+  template <class Input>
+  constexpr auto operator()(Input &&input) const {
+    return std::invoke(second, std::invoke(first, std::forward<Input>(input)));
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A sequence of transformations composed at compile time. Used along
+ * with the options' to and elementsTo methods:
+ *
+ * ```cpp
+ * option.to(input_parser::chain([](const std::string &value) {
+ *   return std::stoi(value);
+ * }).then(clamp).then(lookup));
+ * ```
+ *
+ * @tparam Stage The callable with all the stages composed.
+ */
+template <class Stage>
+class Chain {
+ public:
+  /**
+   * @brief Creates a chain with a single stage.
+   *
+   * @param stage The first transformation.
+   */
+  constexpr explicit Chain(Stage stage) : stage_ {std::move(stage)} {}
+
+  /**
+   * @brief Adds a transformation that receives the result of the chain.
+   *
+   * @param next The transformation to be added.
+   * @return A new chain with the transformation at the end.
+   */
+  template <class Next>
+  constexpr auto then(Next next) const {
+    using Composed = detail::ComposedStage<Stage, std::decay_t<Next>>;
+    return Chain<Composed>(Composed {stage_, std::move(next)});
+  }
+
+  /**
+   * @brief Applies every stage of the chain, one after another.
+   *
+   * @param input The value given to the first stage.
+   * @return A copy of the result of the last stage.
+   */
+  template <class Input>
+  constexpr auto operator()(Input &&input) const {
+    return std::invoke(stage_, std::forward<Input>(input));
+  }
+
+ private:
+  // All the stages composed
+  Stage stage_;
+};
+
+/**
+ * @brief Starts a chain of transformations.
+ *
+ * @param stage The first transformation.
+ * @return A chain with the transformation as its only stage.
+ */
+template <class Stage>
+constexpr auto chain(Stage stage) {
+  return Chain<std::decay_t<Stage>>(std::move(stage));
+}
+
+}  // namespace input_parser
+
+#endif  // _INPUT_CHAIN_HPP_
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file cmdline.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the functions that read the
+ * command line of a running process, as stored in /proc/<pid>/cmdline.
+ *   The buffer read can be given as is to Parser::parseCmdline, so a process
+ * is classified with a single read and no copy of its arguments.
+ *
+ */
+
+#ifndef _INPUT_CMDLINE_HPP_
+#define _INPUT_CMDLINE_HPP_
+
+#include <string>
+#include <string_view>
+
+#include <input_parser/parsing_error.hpp>
+
+namespace input_parser {
+
+/**
+ * @brief Reads the command line of the current process.
+ *
+ * @param buffer Where the command line is read. Its memory is reused, so
+ * the same buffer can be given to read many processes.
+ * @return A view of the command line inside the buffer, or the error
+ * generated if it could not be read.
+ */
+Result<std::string_view> readCmdline(std::string &buffer);
+
+/**
+ * @brief Reads the command line of a running process.
+ *
+ * @param pid The id of the process.
+ * @param buffer Where the command line is read. Its memory is reused, so
+ * the same buffer can be given to read many processes.
+ * @return A view of the command line inside the buffer, or the error
+ * generated if it could not be read (like when the process ended).
+ */
+Result<std::string_view> readCmdline(int pid, std::string &buffer);
+
+}  // namespace input_parser
+
+#endif  // _INPUT_CMDLINE_HPP_
\ No newline at end of file
@@ -0,0 +1,33 @@
+/**
+ * @file config.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the macros that depend on how the library is built
+ * or on the compiler used.
+ *   When INPUT_PARSER_HEADER_ONLY is defined, every definition of the sources
+ * is meant to be included in a header, so they have to be declared inline.
+ *
+ */
+
+#ifndef _INPUT_CONFIG_HPP_
+#define _INPUT_CONFIG_HPP_
+
+#ifdef INPUT_PARSER_HEADER_ONLY
+#define INPUT_PARSER_INLINE inline
+#else
+#define INPUT_PARSER_INLINE
+#endif
+
+// Functions that are rarely called (like the ones that format the help or
+// report errors) are kept apart from the rest of the code, so they do not
+// take space in the instruction cache.
+#if defined(__GNUC__) || defined(__clang__)
+#define INPUT_PARSER_COLD [[gnu::cold]]
+#else
+#define INPUT_PARSER_COLD
+#endif
+
+#endif  // _INPUT_CONFIG_HPP_
\ No newline at end of file
@@ -16,6 +16,8 @@
 #define _INPUT_CONSTRAINT_HPP_
 
 #include <any>
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <string>
 
@@ -44,6 +46,26 @@ class Constraint {
     return error_message_;
   }
 
+  /** @brief Gets the cost expected for a call before any is measured (ns) */
+  inline double getCostHint() const {
+    return cost_hint_;
+  }
+
+  /** @brief Changes the cost expected for a call before any is measured */
+  inline void setCostHint(const double cost_hint) {
+    cost_hint_ = cost_hint;
+  }
+
+  /** @brief Gets how many times measuredCall was called */
+  inline std::size_t getCalls() const {
+    return calls_;
+  }
+
+  /** @brief Gets how many times measuredCall returned false */
+  inline std::size_t getFailures() const {
+    return failures_;
+  }
+
   /**
    * @brief Calls the constraint function with the given value.
    *
@@ -54,11 +76,63 @@ class Constraint {
     return call_(value);
   }
 
+  /**
+   * @brief Calls the constraint function like call does, keeping track of
+   * how often it fails and, from time to time, how long it takes.
+   *
+   * @param value The value to be passed to the constraint function.
+   * @return Whether the constraint function returns true or false.
+   */
+  inline bool measuredCall(const std::any &value) const {
+    const bool sampled = calls_++ % kSampleEvery == 0;
+    const auto start =
+      sampled ? std::chrono::steady_clock::now()
+              : std::chrono::steady_clock::time_point {};
+    const bool result = call_(value);
+    if (sampled) {
+      sampled_time_ += std::chrono::steady_clock::now() - start;
+      ++samples_;
+    }
+    if (!result) ++failures_;
+    return result;
+  }
+
+  /**
+   * @brief Estimates the time spent calling the constraint for every value it
+   * rejects (the cost of a call divided by the chance of failing). Checking
+   * the constraints from the lowest to the highest estimate minimizes the
+   * time needed to reject a value.
+   *
+   * @return The estimate, in nanoseconds.
+   */
+  inline double rejectionCost() const {
+    const std::chrono::duration<double, std::nano> sampled = sampled_time_;
+    const double cost = samples_ == 0
+                        ? cost_hint_
+                        : sampled.count() / static_cast<double>(samples_);
+    const double failure_rate = static_cast<double>(failures_ + 1) /
+                                static_cast<double>(calls_ + 2);
+    return cost / failure_rate;
+  }
+
  private:
+  // One of every how many calls is timed
+  static constexpr std::size_t kSampleEvery = 16;
+
   // The function that must be satisfied.
   const std::function<bool(const std::any &)> call_;
   // The error message to be displayed if the function returns false.
   const std::string error_message_;
+  // The cost expected for a call (ns) until one is measured.
+  double cost_hint_ = 100.0;
+  // How many times the constraint was called through measuredCall.
+  mutable std::size_t calls_ = 0;
+  // How many of those calls returned false.
+  mutable std::size_t failures_ = 0;
+  // How many calls were timed.
+  mutable std::size_t samples_ = 0;
+  // The time spent by the calls timed.
+  mutable std::chrono::steady_clock::duration sampled_time_ {};
 };
 
 }  // namespace input_parser
@@ -0,0 +1,181 @@
+/**
+ * @file constraint_cache.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the cache used to remember the
+ * results of pure constraints (constraints whose result only depends on the
+ * value checked), so validating a value that was already seen costs a single
+ * probe instead of calling the constraint again.
+ *
+ */
+
+#ifndef _INPUT_CONSTRAINT_CACHE_HPP_
+#define _INPUT_CONSTRAINT_CACHE_HPP_
+
+#include <any>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace input_parser {
+
+/**
+ * @brief A bounded cache from a value to the result of a constraint. Every
+ * value goes to a single slot (chosen by its hash), replacing the previous
+ * one, and the slot keeps a copy of the value, so two values with the same
+ * hash are never mistaken.
+ *   The cache can be shared by many options (or copies of a parser) used from
+ * different threads: the slots are guarded by a few locks, each one shared
+ * by many slots.
+ */
+class ConstraintCache {
+ public:
+  /**
+   * @brief Creates an empty cache.
+   *
+   * @param capacity The amount of results the cache can keep.
+   */
+  explicit ConstraintCache(std::size_t capacity = 1024);
+
+  ConstraintCache(const ConstraintCache &) = delete;
+  ConstraintCache &operator=(const ConstraintCache &) = delete;
+
+  /**
+   * @brief Gives an identity to a constraint that uses the cache, so the
+   * constraints that share it do not read each other's results.
+   *
+   * @return The id of the constraint, never repeated by the cache.
+   */
+  inline std::size_t addConstraint() {
+    return next_constraint_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Searches the result stored for a value.
+   *
+   * @param constraint The id of the constraint (see addConstraint).
+   * @param hash The hash of the value.
+   * @param value The value checked.
+   * @return The result of the constraint, if it was stored.
+   */
+  template <std::equality_comparable T>
+  std::optional<bool>
+  find(std::size_t constraint, std::size_t hash, const T &value) const;
+
+  /**
+   * @brief Stores the result of the constraint for a value.
+   *
+   * @param constraint The id of the constraint (see addConstraint).
+   * @param hash The hash of the value.
+   * @param value The value checked.
+   * @param result Whether the value satisfied the constraint or not.
+   */
+  template <std::equality_comparable T>
+  void
+  store(std::size_t constraint, std::size_t hash, const T &value, bool result);
+
+  /** @brief Forgets every result stored and resets the statistics */
+  void clear();
+
+  // ------------------------------ Statistics ----------------------------- //
+
+  /** @brief Gets the amount of results that could be stored at once */
+  inline std::size_t capacity() const {
+    return capacity_;
+  }
+
+  /** @brief Gets how many searches found the result */
+  inline std::size_t hits() const {
+    return hits_.load(std::memory_order_relaxed);
+  }
+
+  /** @brief Gets how many searches did not find the result */
+  inline std::size_t misses() const {
+    return misses_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /** @brief The result of a constraint for a value */
+  struct Slot {
+    // The id of the constraint (0 if the slot is empty)
+    std::size_t constraint = 0;
+    // The hash of the value
+    std::size_t hash = 0;
+    // A copy of the value
+    std::any value;
+    // Whether the value satisfied the constraint or not
+    bool result = false;
+  };
+
+  // The amount of locks guarding the slots
+  static constexpr std::size_t kLocks = 64;
+
+  // The slots of the results
+  std::unique_ptr<Slot[]> slots_;
+  // The slot i is guarded by the lock i % kLocks
+  std::unique_ptr<std::mutex[]> locks_;
+  // The amount of slots
+  std::size_t capacity_;
+  // The id of the next constraint added
+  std::atomic<std::size_t> next_constraint_ {1};
+  // How many searches found the result
+  mutable std::atomic<std::size_t> hits_ {0};
+  // How many searches did not find the result
+  mutable std::atomic<std::size_t> misses_ {0};
+
+  /** @brief Gets the slot of a value of a constraint */
+  inline std::size_t
+  slotOf(const std::size_t constraint, const std::size_t hash) const {
+    // Spreads the bits, since many hashes are the identity
+    auto mixed = static_cast<std::uint64_t>(hash ^ (constraint << 32)) *
+                 0x9E3779B97F4A7C15ULL;
+    mixed ^= mixed >> 29;
+    return static_cast<std::size_t>((mixed >> 16) % capacity_);
+  }
+};
+
+template <std::equality_comparable T>
+std::optional<bool> ConstraintCache::find(
+  const std::size_t constraint, const std::size_t hash, const T &value
+) const {
+  const auto index = slotOf(constraint, hash);
+  {
+    const std::scoped_lock lock(locks_[index % kLocks]);
+    const auto &slot = slots_[index];
+    const auto *stored = std::any_cast<T>(&slot.value);
+    if (slot.constraint == constraint && slot.hash == hash &&
+        stored != nullptr && *stored == value) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return slot.result;
+    }
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return std::nullopt;
+}
+
+template <std::equality_comparable T>
+void ConstraintCache::store(
+  const std::size_t constraint, const std::size_t hash, const T &value,
+  const bool result
+) {
+  const auto index = slotOf(constraint, hash);
+  // The copy is made before taking the lock, and the old one freed after it
+  std::any copy = value;
+  const std::scoped_lock lock(locks_[index % kLocks]);
+  auto &slot = slots_[index];
+  slot.constraint = constraint;
+  slot.hash = hash;
+  slot.value.swap(copy);
+  slot.result = result;
+}
+
+}  // namespace input_parser
+
+#endif  // _INPUT_CONSTRAINT_CACHE_HPP_
\ No newline at end of file
@@ -0,0 +1,206 @@
+/**
+ * @file enum_mask.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the masks decoded by the
+ * compound options that take elements of an enum (see CompoundOption::toMask).
+ *   The names of the elements are stored in a perfect hash table, built once
+ * when the option is created, so every element costs a single hash and a
+ * single comparison. The elements provided become bits of an integer, so
+ * checking if one of them was provided is a single bit operation.
+ *
+ */
+
+#ifndef _INPUT_ENUM_MASK_HPP_
+#define _INPUT_ENUM_MASK_HPP_
+
+#include <any>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace input_parser {
+
+/**
+ * @brief A set of elements of an enum, stored as the bits of an integer: the
+ * element with the underlying value N is the bit N.
+ *
+ * @tparam Enum The enum, whose elements must have values from 0 to 63.
+ */
+template <class Enum>
+requires std::is_enum_v<Enum>
+class EnumMask {
+ public:
+  using Bits = std::uint64_t;
+
+  // The amount of elements that fit in a mask
+  static constexpr std::size_t kMaxElements = 64;
+
+  /** @brief Creates an empty mask */
+  constexpr EnumMask() = default;
+
+  /** @brief Creates a mask from its bits */
+  constexpr explicit EnumMask(const Bits bits) : bits_ {bits} {}
+
+  /** @brief Creates a mask with the elements provided */
+  constexpr EnumMask(const std::initializer_list<Enum> elements) {
+    for (const auto element : elements) set(element);
+  }
+
+  /** @brief Gets the bit that stands for an element */
+  static constexpr std::size_t bitOf(const Enum element) {
+    return static_cast<std::size_t>(element);
+  }
+
+  // ------------------------------- Setters ------------------------------- //
+
+  /**
+   * @brief Adds or removes an element.
+   *
+   * @param element The element to change.
+   * @param value Whether the element should be in the mask or not.
+   * @return The instance of the object that called this method.
+   */
+  constexpr EnumMask &set(const Enum element, const bool value = true) {
+    const auto mask = Bits {1} << bitOf(element);
+    bits_ = value ? bits_ | mask : bits_ & ~mask;
+    return *this;
+  }
+
+  // ------------------------------- Getters ------------------------------- //
+
+  /** @brief Checks if an element is in the mask */
+  constexpr bool contains(const Enum element) const {
+    return ((bits_ >> bitOf(element)) & 1) != 0;
+  }
+
+  /** @brief Checks if every element of another mask is in this one */
+  constexpr bool containsAll(const EnumMask other) const {
+    return (bits_ & other.bits_) == other.bits_;
+  }
+
+  /** @brief Checks if any element of another mask is in this one */
+  constexpr bool containsAny(const EnumMask other) const {
+    return (bits_ & other.bits_) != 0;
+  }
+
+  /** @brief Gets the amount of elements in the mask */
+  constexpr std::size_t count() const {
+    return static_cast<std::size_t>(std::popcount(bits_));
+  }
+
+  /** @brief Checks if the mask has no elements */
+  constexpr bool empty() const {
+    return bits_ == 0;
+  }
+
+  /** @brief Gets the bits of the mask */
+  constexpr Bits bits() const {
+    return bits_;
+  }
+
+  constexpr bool operator==(const EnumMask &other) const = default;
+
+  friend constexpr EnumMask operator|(const EnumMask lhs, const EnumMask rhs) {
+    return EnumMask(lhs.bits_ | rhs.bits_);
+  }
+
+  friend constexpr EnumMask operator&(const EnumMask lhs, const EnumMask rhs) {
+    return EnumMask(lhs.bits_ & rhs.bits_);
+  }
+
+ private:
+  // The bits of the elements in the mask
+  Bits bits_ = 0;
+};
+
+/**
+ * @brief The names of the elements of an enum, stored in a perfect hash
+ * table: every name has a slot of its own, so searching a string only hashes
+ * it and compares it with the name in its slot.
+ */
+class EnumNames {
+ public:
+  using Bits = std::uint64_t;
+
+  /** @brief The result of decoding the values of an option */
+  struct Decoding {
+    // The bits of the elements provided
+    Bits bits = 0;
+    // Whether every element is known and provided only once
+    bool valid = true;
+  };
+
+  /**
+   * @brief Builds the table, searching a hash function without collisions.
+   *   Raises a ParsingError (see raiseError) if a name is repeated or a bit
+   * does not fit in a mask.
+   *
+   * @param elements The names along with the bit of their elements.
+   */
+  explicit EnumNames(std::vector<std::pair<std::string, std::size_t>> elements);
+
+  /**
+   * @brief Searches the bit of the element with the name provided.
+   *
+   * @param name The name of the element.
+   * @return The bit of the element, or nothing if no element has the name.
+   */
+  inline std::optional<std::size_t> find(const std::string_view name) const {
+    const auto slot = slots_[hash(name, seed_) & (slots_.size() - 1)];
+    if (slot == kEmptySlot || elements_[slot].first != name) {
+      return std::nullopt;
+    }
+    return elements_[slot].second;
+  }
+
+  /**
+   * @brief Decodes the values of a compound option: every value, split by
+   * the separator, must be the name of an element.
+   *
+   * @param values The values, as a StringList or a std::vector<std::string>.
+   * @param separator The character between the elements of a single value.
+   * @return The bits of the elements found and whether they were valid.
+   */
+  Decoding decode(const std::any &values, char separator) const;
+
+  /** @brief Gets the amount of names stored */
+  inline std::size_t size() const {
+    return elements_.size();
+  }
+
+ private:
+  // The mark of the slots without name
+  static constexpr std::uint32_t kEmptySlot = 0xFFFFFFFF;
+
+  // The names along with their bits
+  std::vector<std::pair<std::string, std::size_t>> elements_;
+  // The position of the name of every slot (a power of two of them)
+  std::vector<std::uint32_t> slots_;
+  // The seed of the hash function that has no collisions
+  std::uint32_t seed_ = 0;
+
+  /** @brief Hashes a string with the seed provided (FNV-1a) */
+  static inline std::uint32_t
+  hash(const std::string_view name, const std::uint32_t seed) {
+    auto key = 0x811C9DC5U ^ (seed * 0x9E3779B1U);
+    for (const char character : name) {
+      key = (key ^ static_cast<unsigned char>(character)) * 0x01000193U;
+    }
+    return key ^ (key >> 15);
+  }
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_ENUM_MASK_HPP_
\ No newline at end of file
@@ -0,0 +1,206 @@
+/**
+ * @file flag_set.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a packed set of flags, used by
+ * the parser to store the state of every flag option as one bit indexed by
+ * the id of the flag.
+ *
+ */
+
+#ifndef _INPUT_FLAG_SET_HPP_
+#define _INPUT_FLAG_SET_HPP_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace input_parser {
+
+/**
+ * @brief A dynamic set of bits. Iterating over it gives the positions of the
+ * bits that are set, from the lowest to the highest.
+ */
+class FlagSet {
+ public:
+  class Iterator;
+
+  using Word = std::uint64_t;
+  using value_type = std::size_t;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  /** @brief Creates an empty set */
+  FlagSet() = default;
+
+  /**
+   * @brief Creates a set with all the bits unset.
+   *
+   * @param size The amount of bits of the set.
+   */
+  explicit FlagSet(std::size_t size);
+
+  // ------------------------------- Setters ------------------------------- //
+
+  /**
+   * @brief Changes the amount of bits of the set. The new bits are unset.
+   *
+   * @param size The new amount of bits.
+   */
+  void resize(std::size_t size);
+
+  /**
+   * @brief Changes the state of a bit.
+   *
+   * @param id The position of the bit.
+   * @param value Whether the bit should be set or not.
+   */
+  inline void set(const std::size_t id, const bool value = true) {
+    const auto mask = Word {1} << (id % kWordBits);
+    if (value) {
+      words_[id / kWordBits] |= mask;
+    } else {
+      words_[id / kWordBits] &= ~mask;
+    }
+  }
+
+  // ------------------------------- Getters ------------------------------- //
+
+  /** @brief Checks if the bit at the position provided is set */
+  inline bool test(const std::size_t id) const {
+    return ((words_[id / kWordBits] >> (id % kWordBits)) & 1) != 0;
+  }
+
+  /** @brief Gets the amount of bits of the set */
+  inline std::size_t size() const {
+    return size_;
+  }
+
+  /** @brief Gets the amount of bits set */
+  std::size_t count() const;
+
+  /** @brief Gives read-only access to the words that store the bits */
+  inline std::span<const Word> words() const {
+    return words_;
+  }
+
+  // -------------------------------- Checks ------------------------------- //
+
+  /**
+   * @brief Checks if every bit set in the group is also set in this set.
+   *
+   * @param group The bits to check.
+   */
+  bool all(const FlagSet &group) const;
+
+  /**
+   * @brief Checks if at least one bit set in the group is set in this set.
+   *
+   * @param group The bits to check.
+   */
+  bool any(const FlagSet &group) const;
+
+  /** @brief Checks if no bit is set */
+  bool none() const;
+
+  // ------------------------------ Operators ------------------------------ //
+
+  FlagSet &operator&=(const FlagSet &other);
+
+  FlagSet &operator|=(const FlagSet &other);
+
+  friend inline FlagSet operator&(FlagSet lhs, const FlagSet &rhs) {
+    return lhs &= rhs;
+  }
+
+  friend inline FlagSet operator|(FlagSet lhs, const FlagSet &rhs) {
+    return lhs |= rhs;
+  }
+
+  bool operator==(const FlagSet &other) const = default;
+
+  Iterator begin() const;
+
+  Iterator end() const;
+
+ private:
+  static constexpr std::size_t kWordBits = 64;
+
+  // The bits of the set, 64 per word
+  std::vector<Word> words_;
+  // The amount of bits of the set
+  std::size_t size_ = 0;
+};
+
+/** @brief Iterates over the positions of the bits set of a FlagSet */
+class FlagSet::Iterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::size_t;
+
+  Iterator() = default;
+
+  Iterator(const FlagSet *flags, const std::size_t word_index) :
+    flags_ {flags}, word_index_ {word_index} {
+    if (word_index_ < flags_->words_.size()) {
+      word_ = flags_->words_[word_index_];
+      skipEmptyWords();
+    }
+  }
+
+  inline std::size_t operator*() const {
+    return word_index_ * kWordBits +
+           static_cast<std::size_t>(std::countr_zero(word_));
+  }
+
+  inline Iterator &operator++() {
+    // Clears the lowest bit set
+    word_ &= word_ - 1;
+    skipEmptyWords();
+    return *this;
+  }
+
+  inline Iterator operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  friend inline bool operator==(const Iterator &lhs, const Iterator &rhs) {
+    return lhs.word_index_ == rhs.word_index_ && lhs.word_ == rhs.word_;
+  }
+
+ private:
+  // The set being iterated
+  const FlagSet *flags_ = nullptr;
+  // The word that contains the current bit
+  std::size_t word_index_ = 0;
+  // The bits of the current word that have not been visited
+  Word word_ = 0;
+
+  inline void skipEmptyWords() {
+    while (word_ == 0 && ++word_index_ < flags_->words_.size()) {
+      word_ = flags_->words_[word_index_];
+    }
+  }
+};
+
+inline FlagSet::Iterator FlagSet::begin() const {
+  return {this, 0};
+}
+
+inline FlagSet::Iterator FlagSet::end() const {
+  return {this, words_.size()};
+}
+
+}  // namespace input_parser
+
+#endif  // _INPUT_FLAG_SET_HPP_
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * @file glob.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the functions that expand glob
+ * patterns (see CompoundOption::expandGlobs).
+ *   The directories are listed by a small pool of threads, which grows only
+ * while there are directories waiting to be listed, so the patterns are
+ * expanded without starting a shell.
+ *
+ */
+
+#ifndef _INPUT_GLOB_HPP_
+#define _INPUT_GLOB_HPP_
+
+#include <string_view>
+
+#include <input_parser/parse_limits.hpp>
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/string_list.hpp>
+
+namespace input_parser {
+
+/**
+ * @brief Checks if a value has any wildcard: '*', '?' or a bracket
+ * expression like "[a-z]". A wildcard preceded by a backslash is taken
+ * literally.
+ *
+ * @param value The value to check.
+ * @return Whether the value is a glob pattern or not.
+ */
+bool isGlobPattern(std::string_view value);
+
+/**
+ * @brief Matches a name against a single component of a glob pattern: '*'
+ * matches any characters, '?' a single character, and "[...]" one of the
+ * characters of the bracket ("[!...]" or "[^...]" any other one).
+ *
+ * @param pattern The component of the pattern (without slashes).
+ * @param name The name to check.
+ * @return Whether the name matches the pattern or not.
+ */
+bool matchGlob(std::string_view pattern, std::string_view name);
+
+/**
+ * @brief Adds the paths matched by a glob pattern, sorted by their bytes. A
+ * "**" component matches any amount of directories (symbolic links are not
+ * followed through it), and names starting with a dot are only matched by
+ * components that start with a dot too. A pattern without matches is added
+ * as it is, like the shell does.
+ *
+ * @param pattern The pattern to expand, like "logs/20??/[0-9]*.csv".
+ * @param matches Where the paths matched are added.
+ * @param limits The limits on the amount of paths and their length.
+ * @param threads The most threads listing directories at the same time (0
+ * for one per core, up to 8).
+ * @return Nothing, or the error generated if a limit was exceeded.
+ */
+Result<> expandGlob(
+  std::string_view pattern, StringList &matches, const ParseLimits &limits,
+  unsigned int threads = 0
+);
+
+}  // namespace input_parser
+
+#endif  // _INPUT_GLOB_HPP_
\ No newline at end of file
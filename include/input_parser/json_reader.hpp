@@ -0,0 +1,124 @@
+/**
+ * @file json_reader.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of an on-demand JSON reader, used by
+ * Parser::parseJson.
+ *   Nothing is parsed ahead: every value is only read (and checked) when it
+ * is requested, and the values skipped are only scanned for the end of their
+ * strings and brackets. The strings are scanned with memchr, which the
+ * standard library vectorizes, and they are only copied when they have
+ * escape sequences.
+ *
+ */
+
+#ifndef _INPUT_JSON_READER_HPP_
+#define _INPUT_JSON_READER_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <input_parser/parsing_error.hpp>
+
+namespace input_parser {
+
+/** @brief The kinds of JSON value */
+enum class JsonKind { kObject, kArray, kString, kNumber, kBoolean, kNull };
+
+/**
+ * @brief Reads a JSON text from the start to the end, one value at a time.
+ * Every error is reported with ErrorCode::kInvalidArguments.
+ */
+class JsonReader {
+ public:
+  /**
+   * @brief Creates a reader at the start of a text.
+   *
+   * @param text The JSON text, which must outlive the reader.
+   */
+  explicit JsonReader(const std::string_view text) : text_ {text} {}
+
+  /** @brief Gets the kind of the next value, without reading it */
+  Result<JsonKind> peek();
+
+  /**
+   * @brief Reads the start of an object, or the start of an array.
+   *
+   * @param open The bracket expected, '{' or '['.
+   * @return An error if the next value is not of the kind expected.
+   */
+  Result<> enter(char open);
+
+  /**
+   * @brief Moves to the next member of the object entered and reads its key
+   * along with the colon after it.
+   *
+   * @param first Whether it is the first member read from the object.
+   * @param buffer Where the key is decoded (if it has escape sequences).
+   * @return The key, or nothing if the object ended.
+   */
+  Result<std::optional<std::string_view>>
+  nextKey(bool first, std::string &buffer);
+
+  /**
+   * @brief Moves to the next element of the array entered.
+   *
+   * @param first Whether it is the first element read from the array.
+   * @return Whether there is an element or the array ended.
+   */
+  Result<bool> nextElement(bool first);
+
+  /**
+   * @brief Reads a string, a number or a boolean as text: the strings
+   * decoded, the numbers and the booleans as they are written.
+   *
+   * @param buffer Where the string is decoded (if it has escape sequences).
+   * @return The text of the value.
+   */
+  Result<std::string_view> readScalar(std::string &buffer);
+
+  /**
+   * @brief Skips the next value, whatever its kind, without decoding it. The
+   * brackets of an object or an array are only checked to pair up.
+   */
+  Result<> skip();
+
+  /** @brief Checks that nothing but whitespaces is left */
+  Result<> finish();
+
+ private:
+  // The text being read
+  std::string_view text_;
+  // The position of the next character to read
+  std::size_t position_ = 0;
+
+  /** @brief Moves past the whitespaces */
+  void skipSpaces();
+
+  /** @brief Reads the character expected, after any whitespace */
+  Result<> expect(char character);
+
+  /** @brief Reads a string, decoding it only if it has escape sequences */
+  Result<std::string_view> readString(std::string &buffer);
+
+  /** @brief Moves past a string, returning whether it had escape sequences */
+  Result<bool> skipString();
+
+  /** @brief Reads a number as it is written, checking its format */
+  Result<std::string_view> readNumber();
+
+  /** @brief Reads a literal: true, false or null */
+  Result<std::string_view> readLiteral(std::string_view literal);
+
+  /** @brief Creates the error of a malformed text at the current position */
+  std::unexpected<ParsingError> malformed(const char *reason) const;
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_JSON_READER_HPP_
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define _INPUT_LOCAL_CONCEPTS_HPP_
 
 #include <concepts>
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace input_parser {
@@ -14,6 +16,20 @@ template <typename T>
 concept StringKind =
   std::same_as<T, std::string> || std::same_as<T, const char *>;
 
+/** @brief Checks if a type can be hashed with std::hash */
+template <typename T>
+concept Hashable = requires(const T &value) {
+  { std::hash<T> {}(value) } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * @brief Checks if a type can be kept by a ConstraintCache: it can be
+ * hashed, copied and compared.
+ */
+template <typename T>
+concept CacheableValue =
+  Hashable<T> && std::copy_constructible<T> && std::equality_comparable<T>;
+
 }  // namespace input_parser
 
 #endif  // _INPUT_LOCAL_CONCEPTS_HPP_
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ * @file memory_usage.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the memory footprint report
+ * generated by the parser. All the quantities are estimations (in bytes) of
+ * the memory owned by the parser and its options.
+ *
+ */
+
+#ifndef _INPUT_MEMORY_USAGE_HPP_
+#define _INPUT_MEMORY_USAGE_HPP_
+
+#include <any>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace input_parser {
+
+class StringList;
+
+/** @brief The memory (in bytes) owned by a single option */
+struct OptionMemoryUsage {
+  // The reference name of the option
+  std::string name;
+  // The names the option can be recognized by
+  std::size_t names = 0;
+  // The description and the argument placeholder
+  std::size_t descriptions = 0;
+  // The payload of the parsed value (if any)
+  std::size_t value = 0;
+  // The payload of the default value (if any)
+  std::size_t default_value = 0;
+  // The constraint vector, the callables captured and the error messages
+  std::size_t constraints = 0;
+
+  /** @brief Gets the sum of all the quantities */
+  inline std::size_t total() const {
+    return names + descriptions + value + default_value + constraints;
+  }
+};
+
+/** @brief The memory (in bytes) owned by a parser */
+struct MemoryUsage {
+  // The nodes of the map that stores the options (including the options)
+  std::size_t options_nodes = 0;
+  // The bucket array of the map that stores the options
+  std::size_t options_buckets = 0;
+  // The nodes of the map that relates every name to an option
+  std::size_t names_nodes = 0;
+  // The bucket array of the map that relates every name to an option
+  std::size_t names_buckets = 0;
+  // The ids, the names and the packed states of the flag options
+  std::size_t flags = 0;
+  // The heap memory owned by each option, from the biggest to the smallest
+  std::vector<OptionMemoryUsage> options;
+
+  /** @brief Gets the sum of all the quantities */
+  std::size_t total() const;
+};
+
+/**
+ * @brief Estimates the heap memory owned by a string.
+ *
+ * @param str The string to measure.
+ * @return Zero if the string fits in the small buffer, its capacity otherwise.
+ */
+std::size_t heapBytes(const std::string &str);
+
+/** @copydoc heapBytes(const std::string &) */
+std::size_t heapBytes(const std::pmr::string &str);
+
+/**
+ * @brief Estimates the heap memory owned by a value stored by an option.
+ *   Only the types the library produces (booleans, numbers, strings, string
+ * lists and vectors of them) can be measured, any other type counts as zero.
+ *
+ * @param value The value to measure.
+ * @return The bytes allocated outside the std::any object.
+ */
+std::size_t heapBytes(const std::any &value);
+
+}  // namespace input_parser
+
+#endif  // _INPUT_MEMORY_USAGE_HPP_
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+ * @file name_filter.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a prefilter of option names.
+ *   Before searching an argument in the map of names (which hashes the whole
+ * argument) the parser asks the filter, which only looks at the length and a
+ * few characters of the argument. Most of the values given to the options
+ * (like numbers or paths) are rejected there.
+ *
+ */
+
+#ifndef _INPUT_NAME_FILTER_HPP_
+#define _INPUT_NAME_FILTER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace input_parser {
+
+/**
+ * @brief A set of names that can tell for sure when a string is not one of
+ * them. It keeps the first characters and the lengths of the names, along
+ * with a small bloom filter of their digests.
+ */
+class NameFilter {
+ public:
+  /** @brief Creates a filter that rejects every string */
+  NameFilter() = default;
+
+  /**
+   * @brief Adds a name to the filter.
+   *
+   * @param name The name to be added.
+   */
+  void add(std::string_view name);
+
+  /** @brief Removes every name from the filter */
+  inline void clear() {
+    *this = NameFilter();
+  }
+
+  /**
+   * @brief Checks if the string provided can be one of the names added.
+   *
+   * @param name The string to check.
+   * @return False if the string was never added, true if it may have been.
+   */
+  inline bool mayContain(const std::string_view name) const {
+    if (name.size() > max_length_) return false;
+    if (!test(lengths_, lengthSlot(name.size()))) return false;
+    if (name.empty()) return true;
+    if (!test(first_characters_, static_cast<unsigned char>(name.front()))) {
+      return false;
+    }
+    const auto key = digest(name);
+    return test(bloom_, key % kBloomBits) &&
+           test(bloom_, (key >> kSecondProbeShift) % kBloomBits);
+  }
+
+ private:
+  using Word = std::uint64_t;
+
+  static constexpr std::size_t kWordBits = 64;
+  static constexpr std::size_t kBloomBits = 512;
+  static constexpr unsigned int kSecondProbeShift = 16;
+
+  // The first character of every name, one bit per character
+  std::array<Word, 256 / kWordBits> first_characters_ {};
+  // The length of every name (the last bit stands for the longer ones)
+  std::array<Word, 1> lengths_ {};
+  // The bloom filter of the digests of the names
+  std::array<Word, kBloomBits / kWordBits> bloom_ {};
+  // The length of the longest name
+  std::size_t max_length_ = 0;
+
+  template <std::size_t N>
+  static inline bool
+  test(const std::array<Word, N> &bits, const std::size_t id) {
+    return ((bits[id / kWordBits] >> (id % kWordBits)) & 1) != 0;
+  }
+
+  template <std::size_t N>
+  static inline void set(std::array<Word, N> &bits, const std::size_t id) {
+    bits[id / kWordBits] |= Word {1} << (id % kWordBits);
+  }
+
+  /** @brief Gets the bit that stands for the length provided */
+  static inline std::size_t lengthSlot(const std::size_t length) {
+    return length < kWordBits ? length : kWordBits - 1;
+  }
+
+  /**
+   * @brief Mixes the length and a few characters of a non empty string, so
+   * the cost does not depend on how long the string is.
+   */
+  static inline std::uint32_t digest(const std::string_view name) {
+    const auto size = name.size();
+    auto key = static_cast<std::uint32_t>(size) * 0x9E3779B1U;
+    for (const auto index : {std::size_t {1}, size / 2, size - 2, size - 1}) {
+      if (index >= size) continue;
+      key = (key ^ static_cast<unsigned char>(name[index])) * 0x01000193U;
+    }
+    return key ^ (key >> 15);
+  }
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_NAME_FILTER_HPP_
\ No newline at end of file
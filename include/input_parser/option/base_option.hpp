@@ -20,10 +20,17 @@
 #ifndef _INPUT_BASE_OPTION_HPP_
 #define _INPUT_BASE_OPTION_HPP_
 
+#include <concepts>
 #include <stdexcept>
 
+#include <input_parser/chain.hpp>
 #include <input_parser/constraint.hpp>
+#include <input_parser/constraint_cache.hpp>
 #include <input_parser/local_concepts.hpp>
+#include <input_parser/memory_usage.hpp>
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/utf8.hpp>
+#include <input_parser/value_cast.hpp>
 
 namespace input_parser {
 
@@ -38,6 +45,13 @@ class BaseOption {
    */
   BaseOption(StringKind auto const name, StringKind auto const... extra_names);
 
+  /**
+   * @brief Constructs an empty option with the provided names.
+   *
+   * @param names All the names the option can be recognized by (at least one)
+   */
+  explicit BaseOption(std::vector<std::string> names);
+
   // ------------------------------- Adders ------------------------------- //
 
   /**
@@ -75,6 +89,31 @@ class BaseOption {
     const std::string &error_message = ""
   );
 
+  /**
+   * @brief Adds a pure constraint to the option: its result only depends on
+   * the value checked. The results are remembered in the cache provided, by
+   * the constraint and the hash of the value, so checking a value already
+   * seen does not call the constraint again.
+   *   The cache can be shared by the copies of the option (for example, by
+   * copies of a parser) and by other constraints, even from different
+   * threads. Every constraint added gets an identity of its own in the
+   * cache, and the values are compared, not only their hashes.
+   *
+   * @tparam T The type of the value of the option
+   * @tparam Check The type of the constraint.
+   * @param constraint A function that receives the value of the option and
+   * returns a boolean indicating if the value is valid.
+   * @param error_message The error message to be displayed if the constraint
+   * fails.
+   * @param cache Where the results of the constraint are remembered.
+   * @return The instance of the object that called this method.
+   */
+  template <CacheableValue T, std::predicate<const T &> Check>
+  BaseOption &addConstraint(
+    const Check &constraint, const std::string &error_message,
+    const std::shared_ptr<ConstraintCache> &cache
+  );
+
   // ------------------------------- Getters ------------------------------- //
 
   /**
@@ -114,6 +153,14 @@ class BaseOption {
     return argument_name_;
   }
 
+  /**
+   * @brief Estimates the heap memory owned by the option.
+   *   The size of the option object itself is not included.
+   *
+   * @return The memory used by each part of the option.
+   */
+  OptionMemoryUsage memoryUsage() const;
+
   // ------------------------------- Setters ------------------------------- //
 
   /**
@@ -125,6 +172,48 @@ class BaseOption {
    */
   void setValue(const std::any &value);
 
+  /**
+   * @brief Sets the value of the option without throwing.
+   * The value will be transformed if a transformation function was provided.
+   *
+   * @param value The value to set to the option
+   * @return The error generated if the value does not satisfy the
+   * constraints.
+   */
+  Result<> trySetValue(const std::any &value);
+
+  /**
+   * @brief Checks and transforms a value like trySetValue does, without
+   * storing it in the option.
+   *
+   * @param value The value to be converted.
+   * @return The value transformed, or the error generated if it does not
+   * satisfy the constraints.
+   */
+  Result<std::any> convertValue(const std::any &value) const;
+
+  /**
+   * @brief Moves the value of the option to the interner provided, if it is
+   * a std::string. It can still be read as a std::string (see valueCast).
+   *
+   * @param interner Where the value will be stored.
+   */
+  void internValue(StringInterner &interner);
+
+  /**
+   * @brief Removes the value of the option, so it is read again as if it was
+   * never provided (the default value is kept).
+   */
+  void clearValue();
+
+  /**
+   * @brief Searches the first invalid UTF-8 sequence of the value of the
+   * option, if it is stored as strings (see findInvalidUtf8Value).
+   *
+   * @return The position of the sequence, or nothing if the value is valid.
+   */
+  std::optional<Utf8Error> findInvalidUtf8() const;
+
   // ------------------------------- Checks ------------------------------- //
 
   /** @brief Checks if the option is a flag */
@@ -202,7 +291,34 @@ class BaseOption {
    */
   BaseOption &beRequired(const bool required = true);
 
+  /**
+   * @brief Makes the option check its constraints in the order expected to
+   * reject a wrong value the soonest: the cheap constraints that fail often
+   * go first. The cost and the failures of every constraint are measured
+   * while checking values, and the order is updated from time to time.
+   *   The error of a value that fails a single constraint does not change.
+   * When a value fails several ones, the error may come from any of them.
+   *
+   * @param adaptive Whether the order should adapt or follow the order the
+   * constraints were added in. True by default.
+   * @return The instance of the object that called this method.
+   */
+  BaseOption &orderConstraintsAdaptively(const bool adaptive = true);
+
+  /**
+   * @brief Tells how long the last constraint added is expected to take, so
+   * it can be sorted (see orderConstraintsAdaptively) before its cost is
+   * measured.
+   *
+   * @param nanoseconds The expected time of a call to the constraint.
+   * @return The instance of the object that called this method.
+   */
+  BaseOption &hintConstraintCost(const double nanoseconds);
+
  protected:
+  // How many values are checked between two updates of the constraint order
+  static constexpr std::size_t kReorderEvery = 32;
+
   // The value of the option
   std::any value_;
   // The default value of the option
@@ -216,10 +332,18 @@ class BaseOption {
   // Indicates if the transformation function should be applied before or after
   // the constraints
   bool transform_before_check_;
-  // A function that transforms the value of the option
+  // A function that transforms the value of the option (a malformed value is
+  // reported by returning its ParsingError, see transform)
   std::function<std::any(const std::any &)> transformation_;
   // A list of constraints that the value of the option must satisfy
   std::vector<Constraint> constraints_;
+  // Indicates if the constraints are checked in the order measured as the
+  // fastest (see orderConstraintsAdaptively)
+  bool adaptive_order_;
+  // The positions of the constraints, in the order they are checked
+  mutable std::vector<std::size_t> constraint_order_;
+  // How many values were checked in adaptive order
+  mutable std::size_t checks_;
   // The placeholder for the argument of the option
   std::string argument_name_;
 
@@ -227,16 +351,35 @@ class BaseOption {
    * @brief Checks if the provided value satisfies all the constraints.
    *
    * @param value The value to check
+   * @return The error of the first constraint not satisfied.
    */
-  void checkConstraints(const std::any &value) const;
+  Result<> checkConstraints(const std::any &value) const;
+
+  /**
+   * @brief Applies the transformation to a value.
+   *
+   * @param value The value to transform.
+   * @return The value transformed, or the error returned by the
+   * transformation if the value is malformed.
+   */
+  Result<std::any> transform(const std::any &value) const;
+
+  /** @brief Sorts the constraints by the time they need to reject a value */
+  void sortConstraints() const;
+
+  /**
+   * @brief Adds a constraint that rejects the strings that are not valid
+   * UTF-8 (the values transformed into other types before being checked
+   * are accepted).
+   *
+   * @return The instance of the object that called this method.
+   */
+  BaseOption &validUtf8();
 };
 
 BaseOption::BaseOption(
   StringKind auto const name, StringKind auto const... extra_names
-) : required_ {true}, transform_before_check_ {false} {
-  names_ = {name, extra_names...};
-  transformation_ = [](const std::any &value) -> std::any { return value; };
-}
+) : BaseOption(std::vector<std::string> {name, extra_names...}) {}
 
 template <class T>
 BaseOption &BaseOption::addConstraint(
@@ -245,7 +388,30 @@ BaseOption &BaseOption::addConstraint(
 ) {
   constraints_.emplace_back(
     [constraint](const std::any &value) -> bool {
-      return constraint(std::any_cast<T>(value));
+      return constraint(valueCast<T>(value));
+    },
+    error_message
+  );
+  return *this;
+}
+
+template <CacheableValue T, std::predicate<const T &> Check>
+BaseOption &BaseOption::addConstraint(
+  const Check &constraint, const std::string &error_message,
+  const std::shared_ptr<ConstraintCache> &cache
+) {
+  // Kept by the copies of the option, which share the results
+  const auto id = cache->addConstraint();
+  constraints_.emplace_back(
+    [constraint, cache, id](const std::any &value) -> bool {
+      const auto typed_value = valueCast<T>(value);
+      const auto hash = std::hash<T> {}(typed_value);
+      if (const auto result = cache->find(id, hash, typed_value)) {
+        return *result;
+      }
+      const auto result = constraint(typed_value);
+      cache->store(id, hash, typed_value, result);
+      return result;
     },
     error_message
   );
@@ -255,13 +421,17 @@ BaseOption &BaseOption::addConstraint(
 template <class T>
 const T BaseOption::getValue() const {
   if (!hasValue()) return getDefaultValue<T>();
-  return std::any_cast<T>(value_);
+  return valueCast<T>(value_);
 }
 
 template <class T>
 const T BaseOption::getDefaultValue() const {
-  if (!hasDefaultValue()) throw std::invalid_argument("No default value");
-  return std::any_cast<T>(transformation_(default_value_));
+  if (!hasDefaultValue()) {
+    raiseError("No default value", ErrorCode::kNoDefaultValue);
+  }
+  auto value = transform(default_value_);
+  if (!value) raiseError(value.error());
+  return valueCast<T>(*value);
 }
 
 }  // namespace input_parser
@@ -14,6 +14,13 @@
 #ifndef _INPUT_COMPOUND_OPTION_HPP_
 #define _INPUT_COMPOUND_OPTION_HPP_
 
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <input_parser/enum_mask.hpp>
 #include <input_parser/option/base_option.hpp>
 
 namespace input_parser {
@@ -41,6 +48,13 @@ class CompoundOption final : public BaseOption {
     StringKind auto const name, StringKind auto const... extra_names
   );
 
+  /**
+   * @brief Constructs an empty option with the provided names.
+   *
+   * @param names All the names the option can be recognized by (at least one)
+   */
+  explicit CompoundOption(std::vector<std::string> names);
+
   /**
    * @brief Indicates if the option is a compound option.
    *
@@ -52,8 +66,11 @@ class CompoundOption final : public BaseOption {
 
   /**
    * @brief Transform the vector that contains the option's values using the
-   * provided function. The function must take a const std::vector<std::string>&
-   * as argument and return the type provided as template argument.
+   * provided function.
+   *   Without any transformation the values are stored as a StringList, which
+   * can also be read as a std::vector<std::string>. The function must take a
+   * const std::vector<std::string>& as argument and return the type provided
+   * as template argument.
    *
    * Only works for compound options.
    *
@@ -65,6 +82,18 @@ class CompoundOption final : public BaseOption {
   CompoundOption &
   to(const std::function<T(const std::vector<std::string> &)> &transformation);
 
+  /**
+   * @brief Transform the vector that contains the option's values using a
+   * chain of transformations (see Chain). The first stage must take a
+   * const std::vector<std::string>& as argument, and the value stored is the
+   * result of the last one.
+   *
+   * @param transformation The stages that transform the vector of values
+   * @return The instance of the object that called this method.
+   */
+  template <class Stage>
+  CompoundOption &to(const Chain<Stage> &transformation);
+
   /**
    * @brief Transform each option value using the provided function.
    * The function must take a const std::string& as argument and return the
@@ -78,41 +107,109 @@ class CompoundOption final : public BaseOption {
   CompoundOption &
   elementsTo(const std::function<T(const std::string &)> &transformation);
 
+  /**
+   * @brief Transform each option value using a chain of transformations (see
+   * Chain). The first stage must take a const std::string& as argument, and
+   * the values stored are the results of the last one.
+   *
+   * @param transformation The stages that transform the values of the option
+   * @return The instance of the object that called this method.
+   */
+  template <class Stage>
+  CompoundOption &elementsTo(const Chain<Stage> &transformation);
+
   /**
    * @brief Converts all the elements of the option to integers.
    *
-   * Shortcut for:
-   * ```cpp
-   * option.elementsTo<int>([](const std::string& value) -> int {
-   *   return std::stoi(value);
-   * });
-   * ```
+   * Every element must be an integer (see numberCast), or setting the values
+   * fails with ErrorCode::kBadValueType.
    */
   CompoundOption &toInt() override;
 
   /**
    * @brief Converts all the elements of the option to doubles.
    *
-   * Shortcut for:
-   * ```cpp
-   * option.elementsTo<double>([](const std::string& value) -> double {
-   *   return std::stod(value);
-   * });
-   * ```
+   * Every element must be a double (see numberCast), or setting the values
+   * fails with ErrorCode::kBadValueType.
    */
   CompoundOption &toDouble() override;
 
   /**
    * @brief Converts all the elements of the option to floats.
    *
-   * Shortcut for:
+   * Every element must be a float (see numberCast), or setting the values
+   * fails with ErrorCode::kBadValueType.
+   */
+  CompoundOption &toFloat() override;
+
+  /**
+   * @brief Decodes the elements of the option as a set of elements of an
+   * enum (see EnumMask). The elements can be given as different values
+   * ("--features a b c") or inside a single one ("--features a,b,c"):
+   *
    * ```cpp
-   * option.elementsTo<float>([](const std::string& value) -> float {
-   *   return std::stof(value);
-   * });
+   * option.toMask<Feature>({{"a", Feature::kA}, {"b", Feature::kB}});
+   * parser.getValue<EnumMask<Feature>>("--features").contains(Feature::kA);
    * ```
+   *
+   * An unknown or repeated element fails the constraints of the option. The
+   * values are decoded only once, before checking the constraints (see
+   * transformBeforeCheck), so the rest of them receive the mask.
+   *
+   * @tparam Enum The enum, whose elements must have values from 0 to 63.
+   * @param elements The name of every element, along with the element.
+   * @param separator The character between the elements of a single value.
+   * @return The instance of the object that called this method.
    */
-  CompoundOption &toFloat() override;
+  template <class Enum>
+  CompoundOption &toMask(
+    std::initializer_list<std::pair<std::string_view, Enum>> elements,
+    char separator = ','
+  );
+
+  /**
+   * @brief Lets the option read its values from a stream, so lists larger
+   * than the command line can be piped in:
+   *
+   * ```sh
+   * find . -print0 | program --inputs -
+   * ```
+   *
+   * When "-" (the standard input) or "fd:N" (the file descriptor N) is the
+   * only value given, every record of the stream becomes a value of the
+   * option.
+   *
+   * @param delimiter The character that ends every record ('\0' or '\n').
+   * @return The instance of the object that called this method.
+   */
+  inline CompoundOption &streamValues(const char delimiter = '\0') {
+    stream_delimiter_ = delimiter;
+    return *this;
+  }
+
+  /** @brief Gets the delimiter of the stream records, if streams are read */
+  inline std::optional<char> getStreamDelimiter() const {
+    return stream_delimiter_;
+  }
+
+  /**
+   * @brief Lets the option expand the glob patterns given as values, for the
+   * programs executed without a shell. Every value with a wildcard ('*', '?'
+   * or a bracket expression, and "**" for any amount of directories) is
+   * replaced by the paths it matches, sorted (see expandGlob).
+   *
+   * @param expand Whether the glob patterns are expanded or not.
+   * @return The instance of the object that called this method.
+   */
+  inline CompoundOption &expandGlobs(const bool expand = true) {
+    expand_globs_ = expand;
+    return *this;
+  }
+
+  /** @brief Checks if the glob patterns given as values are expanded */
+  inline bool expandsGlobs() const {
+    return expand_globs_;
+  }
 
   // ------------------------ Static casted methods ------------------------ //
 
@@ -135,6 +232,16 @@ class CompoundOption final : public BaseOption {
     );
   }
 
+  template <CacheableValue T, std::predicate<const T &> Check>
+  inline CompoundOption &addConstraint(
+    const Check &constraint, const std::string &error_message,
+    const std::shared_ptr<ConstraintCache> &cache
+  ) {
+    return static_cast<CompoundOption &>(
+      BaseOption::addConstraint<T>(constraint, error_message, cache)
+    );
+  }
+
   inline CompoundOption &transformBeforeCheck() {
     return static_cast<CompoundOption &>(BaseOption::transformBeforeCheck());
   }
@@ -142,21 +249,86 @@ class CompoundOption final : public BaseOption {
   inline CompoundOption &beRequired(const bool &required = true) {
     return static_cast<CompoundOption &>(BaseOption::beRequired(required));
   }
+
+  inline CompoundOption &
+  orderConstraintsAdaptively(const bool adaptive = true) {
+    return static_cast<CompoundOption &>(
+      BaseOption::orderConstraintsAdaptively(adaptive)
+    );
+  }
+
+  inline CompoundOption &hintConstraintCost(const double nanoseconds) {
+    return static_cast<CompoundOption &>(
+      BaseOption::hintConstraintCost(nanoseconds)
+    );
+  }
+
+  /**
+   * @brief Rejects the values that are not valid UTF-8. To check every
+   * option at once, after the parse, see Parser::requireUtf8.
+   *
+   * @return The instance of the object that called this method.
+   */
+  inline CompoundOption &validUtf8() {
+    return static_cast<CompoundOption &>(BaseOption::validUtf8());
+  }
+
+ private:
+  // The delimiter of the records read from a stream (if streams are read)
+  std::optional<char> stream_delimiter_;
+  // Whether the glob patterns given as values are expanded
+  bool expand_globs_ = false;
 };
 
 CompoundOption::CompoundOption(
   StringKind auto const name, StringKind auto const... extra_names
-) : BaseOption(name, extra_names...) {
-  argument_name_ = " value1 value2 ...";
-}
+) : CompoundOption(std::vector<std::string> {name, extra_names...}) {}
 
 template <class T>
 CompoundOption &CompoundOption::to(
   const std::function<T(const std::vector<std::string> &)> &transformation
 ) {
-  transformation_ = [transformation](const std::any &value) -> auto {
-    return transformation(std::any_cast<std::vector<std::string>>(value));
+  return to(chain(transformation));
+}
+
+template <class Stage>
+CompoundOption &CompoundOption::to(const Chain<Stage> &transformation) {
+  transformation_ = [transformation](const std::any &value) -> std::any {
+    return transformation(valueCast<std::vector<std::string>>(value));
+  };
+  return *this;
+}
+
+template <class Enum>
+CompoundOption &CompoundOption::toMask(
+  const std::initializer_list<std::pair<std::string_view, Enum>> elements,
+  const char separator
+) {
+  std::vector<std::pair<std::string, std::size_t>> bits;
+  bits.reserve(elements.size());
+  for (const auto &[name, element] : elements) {
+    bits.emplace_back(name, EnumMask<Enum>::bitOf(element));
+  }
+  // Shared by every copy of the transformation, built only once
+  const auto names = std::make_shared<const EnumNames>(std::move(bits));
+  // The invalid values are left as they are, so the constraint only has to
+  // check if they were decoded
+  transform_before_check_ = true;
+  transformation_ = [names, separator](const std::any &values) -> std::any {
+    if (std::any_cast<EnumMask<Enum>>(&values) != nullptr) return values;
+    const auto decoding = names->decode(values, separator);
+    if (!decoding.valid) return values;
+    return EnumMask<Enum>(decoding.bits);
   };
+  constraints_.emplace_back(
+    [](const std::any &values) {
+      return std::any_cast<EnumMask<Enum>>(&values) != nullptr;
+    },
+    "Unknown or repeated element provided to " + names_.front() + "!"
+  );
+  // A single type check, so it goes first until it is measured
+  constraints_.back().setCostHint(1);
+  constraint_order_.clear();
   return *this;
 }
 
@@ -164,11 +336,29 @@ template <class T>
 CompoundOption &CompoundOption::elementsTo(
   const std::function<T(const std::string &)> &transformation
 ) {
-  transformation_ = [transformation](const std::any &values) -> auto {
-    const auto string_values = std::any_cast<std::vector<std::string>>(values);
+  return elementsTo(chain(transformation));
+}
+
+template <class Stage>
+CompoundOption &CompoundOption::elementsTo(const Chain<Stage> &transformation
+) {
+  using T = std::decay_t<
+    std::invoke_result_t<const Chain<Stage> &, const std::string &>>;
+  transformation_ = [transformation](const std::any &values) -> std::any {
     std::vector<T> transformed_values;
-    for (const auto &value : string_values) {
-      transformed_values.push_back(transformation(value));
+    const auto transform_all = [&](const auto &string_values) {
+      transformed_values.reserve(string_values.size());
+      // Reused by every element, so it only allocates for the longest one
+      std::string element;
+      for (const std::string_view value : string_values) {
+        element.assign(value);
+        transformed_values.push_back(transformation(element));
+      }
+    };
+    if (const auto *list = std::any_cast<StringList>(&values)) {
+      transform_all(*list);
+    } else {
+      transform_all(valueCast<std::vector<std::string>>(values));
     }
     return transformed_values;
   };
@@ -39,6 +39,14 @@ class FlagOption final : public BaseOption {
   FlagOption(StringKind auto const name, StringKind auto const... extra_names) :
     BaseOption(name, extra_names...) {}
 
+  /**
+   * @brief Constructs an empty option with the provided names.
+   *
+   * @param names All the names the option can be recognized by (at least one)
+   */
+  explicit FlagOption(std::vector<std::string> names) :
+    BaseOption(std::move(names)) {}
+
   /**
    * @brief Indicates if the option is a flag.
    *
@@ -48,6 +56,15 @@ class FlagOption final : public BaseOption {
     return true;
   }
 
+  /**
+   * @brief Gets the state of the flag when it is not specified, which is the
+   * default value before any transformation (false if there is none).
+   */
+  inline bool getDefaultState() const {
+    const auto *state = std::any_cast<bool>(&default_value_);
+    return state != nullptr && *state;
+  }
+
   /**
    * @brief Transforms the value of the option using the provided function.
    * The function must take a const bool& as argument and return the type
@@ -60,6 +77,17 @@ class FlagOption final : public BaseOption {
   template <class T>
   FlagOption &to(const std::function<T(const bool &)> &transformation);
 
+  /**
+   * @brief Transforms the value of the option using a chain of
+   * transformations (see Chain). The first stage must take a const bool& as
+   * argument, and the value stored is the result of the last one.
+   *
+   * @param transformation The stages that transform the value of the option
+   * @return The instance of the object that called this method.
+   */
+  template <class Stage>
+  FlagOption &to(const Chain<Stage> &transformation);
+
   /**
    * @brief Converts the value of the option to an integer.
    *
@@ -113,6 +141,16 @@ class FlagOption final : public BaseOption {
     );
   }
 
+  template <CacheableValue T, std::predicate<const T &> Check>
+  inline FlagOption &addConstraint(
+    const Check &constraint, const std::string &error_message,
+    const std::shared_ptr<ConstraintCache> &cache
+  ) {
+    return static_cast<FlagOption &>(
+      BaseOption::addConstraint<T>(constraint, error_message, cache)
+    );
+  }
+
   inline FlagOption &transformBeforeCheck() {
     return static_cast<FlagOption &>(BaseOption::transformBeforeCheck());
   }
@@ -120,13 +158,31 @@ class FlagOption final : public BaseOption {
   inline FlagOption &beRequired(const bool &required = true) {
     return static_cast<FlagOption &>(BaseOption::beRequired(required));
   }
+
+  inline FlagOption &
+  orderConstraintsAdaptively(const bool adaptive = true) {
+    return static_cast<FlagOption &>(
+      BaseOption::orderConstraintsAdaptively(adaptive)
+    );
+  }
+
+  inline FlagOption &hintConstraintCost(const double nanoseconds) {
+    return static_cast<FlagOption &>(
+      BaseOption::hintConstraintCost(nanoseconds)
+    );
+  }
 };
 
 template <class T>
 FlagOption &
 FlagOption::to(const std::function<T(const bool &)> &transformation) {
+  return to(chain(transformation));
+}
+
+template <class Stage>
+FlagOption &FlagOption::to(const Chain<Stage> &transformation) {
   transformation_ = [transformation](const std::any &value) -> std::any {
-    return transformation(std::any_cast<bool>(value));
+    return transformation(valueCast<bool>(value));
   };
   return *this;
 }
@@ -0,0 +1,136 @@
+/**
+ * @file option_family.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a family of options: the single
+ * options whose names match a pattern like "--log-level-*". Every name
+ * provided is a member of the family, identified by the key that replaces
+ * the asterisk ("--log-level-net" has the key "net").
+ *
+ */
+
+#ifndef _INPUT_OPTION_FAMILY_HPP_
+#define _INPUT_OPTION_FAMILY_HPP_
+
+#include <any>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <input_parser/memory_usage.hpp>
+#include <input_parser/option/single_option.hpp>
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/utf8.hpp>
+#include <input_parser/value_cast.hpp>
+
+namespace input_parser {
+
+/**
+ * @brief A family of single options. The members share the description, the
+ * constraints, the transformation and the default value of a prototype, and
+ * their values are stored in a flat map sorted by key.
+ */
+class OptionFamily {
+ public:
+  /**
+   * @brief Creates a family without members.
+   *
+   * @param prototype An option whose names are the patterns of the family.
+   */
+  explicit OptionFamily(SingleOption prototype) :
+    prototype_ {std::move(prototype)} {}
+
+  // ------------------------------- Getters ------------------------------- //
+
+  /** @brief Gets the option every member is a copy of */
+  inline const SingleOption &getPrototype() const {
+    return prototype_;
+  }
+
+  /**
+   * @brief Gets the value of a member of the family.
+   *   If the member was not provided, the default value of the prototype will
+   * be returned.
+   *
+   * @tparam T The type of the value to be returned.
+   * @param key The key of the member.
+   * @return The value of the member casted to the specified type.
+   */
+  template <class T>
+  T getValue(std::string_view key) const;
+
+  /** @brief Gets the keys of the members provided, sorted */
+  std::vector<std::string_view> getKeys() const;
+
+  /** @brief Gets the amount of members provided */
+  inline std::size_t size() const {
+    return values_.size();
+  }
+
+  /** @brief Checks if the member with the key provided was provided */
+  inline bool contains(const std::string_view key) const {
+    return find(key) != values_.end();
+  }
+
+  /**
+   * @brief Searches the first member, in the order of the keys, whose value
+   * is stored as strings and is not valid UTF-8 (see findInvalidUtf8Value).
+   *
+   * @return The key of the member along with the position of the sequence,
+   * or nothing if every value is valid.
+   */
+  std::optional<std::pair<std::string_view, Utf8Error>>
+  findInvalidUtf8() const;
+
+  /**
+   * @brief Estimates the heap memory owned by the family: the prototype and
+   * the keys and values of its members.
+   *
+   * @return The memory used by each part of the family.
+   */
+  OptionMemoryUsage memoryUsage() const;
+
+  // ------------------------------- Setters ------------------------------- //
+
+  /**
+   * @brief Sets the value of a member, adding it if it is new. The value is
+   * checked and transformed by the prototype.
+   *
+   * @param key The key of the member.
+   * @param value The value to be assigned.
+   * @return The error generated if the value does not satisfy the
+   * constraints.
+   */
+  Result<> trySetValue(std::string_view key, const std::any &value);
+
+  /** @brief Removes every member, keeping the prototype */
+  void clearValues();
+
+ private:
+  using Entry = std::pair<std::string, std::any>;
+
+  // The option every member is a copy of
+  SingleOption prototype_;
+  // The key and the value of every member, sorted by key
+  std::vector<Entry> values_;
+
+  /** @brief Searches a member by its key */
+  std::vector<Entry>::const_iterator find(std::string_view key) const;
+};
+
+template <class T>
+T OptionFamily::getValue(const std::string_view key) const {
+  const auto member = find(key);
+  if (member == values_.end()) return prototype_.getDefaultValue<T>();
+  return valueCast<T>(member->second);
+}
+
+}  // namespace input_parser
+
+#endif  // _INPUT_OPTION_FAMILY_HPP_
\ No newline at end of file
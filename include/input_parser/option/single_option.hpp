@@ -40,6 +40,13 @@ class SingleOption final : public BaseOption {
     StringKind auto const name, StringKind auto const... extra_names
   );
 
+  /**
+   * @brief Constructs an empty option with the provided names.
+   *
+   * @param names All the names the option can be recognized by (at least one)
+   */
+  explicit SingleOption(std::vector<std::string> names);
+
   /**
    * @brief Indicates if the option is a single option.
    *
@@ -61,15 +68,23 @@ class SingleOption final : public BaseOption {
   template <class T>
   SingleOption &to(const std::function<T(const std::string &)> &transformation);
 
+  /**
+   * @brief Transforms the value of the option using a chain of
+   * transformations (see Chain). The first stage must take a
+   * const std::string& as argument, and the value stored is the result of the
+   * last one.
+   *
+   * @param transformation The stages that transform the value of the option
+   * @return The instance of the object that called this method.
+   */
+  template <class Stage>
+  SingleOption &to(const Chain<Stage> &transformation);
+
   /**
    * @brief Transform the string value to an integer.
    *
-   * Shortcut for:
-   * ```cpp
-   * option.to<int>([](const std::string& value) -> int {
-   *   return std::stoi(value);
-   * });
-   * ```
+   * The whole value must be an integer (see numberCast), or setting it fails
+   * with ErrorCode::kBadValueType.
    *
    * @return The option itself.
    */
@@ -78,12 +93,8 @@ class SingleOption final : public BaseOption {
   /**
    * @brief Transform the string value to a double.
    *
-   * Shortcut for:
-   * ```cpp
-   * option.to<double>([](const std::string& value) -> double {
-   *   return std::stod(value);
-   * });
-   * ```
+   * The whole value must be a double (see numberCast), or setting it fails
+   * with ErrorCode::kBadValueType.
    *
    * @return The option itself.
    */
@@ -92,12 +103,8 @@ class SingleOption final : public BaseOption {
   /**
    * @brief Transform the string value to a float.
    *
-   * Shortcut for:
-   * ```cpp
-   * option.to<float>([](const std::string& value) -> float {
-   *   return std::stof(value);
-   * });
-   * ```
+   * The whole value must be a float (see numberCast), or setting it fails
+   * with ErrorCode::kBadValueType.
    *
    * @return The option itself.
    */
@@ -123,6 +130,16 @@ class SingleOption final : public BaseOption {
     );
   }
 
+  template <CacheableValue T, std::predicate<const T &> Check>
+  inline SingleOption &addConstraint(
+    const Check &constraint, const std::string &error_message,
+    const std::shared_ptr<ConstraintCache> &cache
+  ) {
+    return static_cast<SingleOption &>(
+      BaseOption::addConstraint<T>(constraint, error_message, cache)
+    );
+  }
+
   inline SingleOption &transformBeforeCheck() {
     return static_cast<SingleOption &>(BaseOption::transformBeforeCheck());
   }
@@ -130,19 +147,48 @@ class SingleOption final : public BaseOption {
   inline SingleOption &beRequired(const bool &required = true) {
     return static_cast<SingleOption &>(BaseOption::beRequired(required));
   }
+
+  inline SingleOption &
+  orderConstraintsAdaptively(const bool adaptive = true) {
+    return static_cast<SingleOption &>(
+      BaseOption::orderConstraintsAdaptively(adaptive)
+    );
+  }
+
+  inline SingleOption &hintConstraintCost(const double nanoseconds) {
+    return static_cast<SingleOption &>(
+      BaseOption::hintConstraintCost(nanoseconds)
+    );
+  }
+
+  /**
+   * @brief Rejects the values that are not valid UTF-8. To check every
+   * option at once, after the parse, see Parser::requireUtf8.
+   *
+   * @return The instance of the object that called this method.
+   */
+  inline SingleOption &validUtf8() {
+    return static_cast<SingleOption &>(BaseOption::validUtf8());
+  }
 };
 
 SingleOption::SingleOption(
   StringKind auto const name, StringKind auto const... extra_names
-) : BaseOption(name, extra_names...) {
-  argument_name_ = " value";
-}
+) : SingleOption(std::vector<std::string> {name, extra_names...}) {}
 
 template <class T>
 SingleOption &
 SingleOption::to(const std::function<T(const std::string &)> &transformation) {
-  transformation_ = [transformation](const std::any &value) -> auto {
-    return transformation(std::any_cast<std::string>(value));
+  return to(chain(transformation));
+}
+
+template <class Stage>
+SingleOption &SingleOption::to(const Chain<Stage> &transformation) {
+  transformation_ = [transformation](const std::any &value) -> std::any {
+    if (const auto *text = std::any_cast<std::string>(&value)) {
+      return transformation(*text);
+    }
+    return transformation(valueCast<std::string>(value));
   };
   return *this;
 }
@@ -0,0 +1,46 @@
+/**
+ * @file parse_limits.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the limits a parser enforces on
+ * the arguments it reads, so arguments coming from untrusted clients can not
+ * use unbounded memory or time.
+ *   Every limit is checked while the arguments are read, and the first one
+ * exceeded stops the parsing with ErrorCode::kLimitExceeded.
+ *
+ */
+
+#ifndef _INPUT_PARSE_LIMITS_HPP_
+#define _INPUT_PARSE_LIMITS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+namespace input_parser {
+
+/** @brief The limits of a parse, none of them is enforced by default */
+struct ParseLimits {
+  // The amount of arguments (the name of the program is not counted)
+  std::size_t max_arguments = std::numeric_limits<std::size_t>::max();
+  // The amount of characters of a single argument
+  std::size_t max_argument_length = std::numeric_limits<std::size_t>::max();
+  // The amount of values given to a single compound option
+  std::size_t max_compound_values = std::numeric_limits<std::size_t>::max();
+  // The amount of characters of all the arguments together
+  std::size_t max_total_bytes = std::numeric_limits<std::size_t>::max();
+  // The time spent setting the values: the transformations and constraints
+  std::chrono::nanoseconds max_value_time = std::chrono::nanoseconds::max();
+
+  /** @brief Checks if the time spent setting the values has to be measured */
+  inline bool limitsValueTime() const {
+    return max_value_time != std::chrono::nanoseconds::max();
+  }
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_PARSE_LIMITS_HPP_
\ No newline at end of file
@@ -12,16 +12,35 @@
 #ifndef _INPUT_PARSER_PARSER_HPP_
 #define _INPUT_PARSER_PARSER_HPP_
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
 #include <unordered_map>
 #include <variant>
 
+#include <input_parser/config.hpp>
+#include <input_parser/flag_set.hpp>
+#include <input_parser/memory_usage.hpp>
+#include <input_parser/name_filter.hpp>
 #include <input_parser/option/compound_option.hpp>
 #include <input_parser/option/flag_option.hpp>
+#include <input_parser/option/option_family.hpp>
 #include <input_parser/option/single_option.hpp>
+#include <input_parser/parse_limits.hpp>
 #include <input_parser/parsing_error.hpp>
+#include <input_parser/pattern_matcher.hpp>
+#include <input_parser/schema.hpp>
+#include <input_parser/string_interner.hpp>
+#include <input_parser/string_hash.hpp>
 
 namespace input_parser {
 
+class JsonReader;
+
 /** @brief The type of an option */
 using Option = std::variant<FlagOption, CompoundOption, SingleOption>;
 
@@ -31,8 +50,97 @@ using Option = std::variant<FlagOption, CompoundOption, SingleOption>;
  */
 class Parser {
  public:
+  class Subtree;
+
   /** @brief Create an empty parser with no options */
-  Parser() = default;
+  Parser() : Parser(std::pmr::get_default_resource()) {}
+
+  /**
+   * @brief Create an empty parser with no options whose maps, names and
+   * parsing buffers are allocated from the memory resource provided. The
+   * resource must outlive the parser.
+   *
+   * @param resource The memory resource to allocate from.
+   */
+  explicit Parser(std::pmr::memory_resource *resource) :
+    resource_ {resource}, options_ {resource}, names_ {resource},
+    flag_ids_ {resource}, flag_names_ {resource}, paths_ {resource},
+    families_ {resource}, family_ids_ {resource} {}
+
+  /**
+   * @brief Create a parser with the options of the schema provided. The names
+   * were already checked while compiling, and the maps are sized for all of
+   * them up front.
+   *   Flags are false by default, and the rest of options have no default
+   * value (they hold the strings provided).
+   *
+   * @param schema The options of the parser.
+   * @param resource The memory resource to allocate from.
+   */
+  template <std::size_t Options, std::size_t Names>
+  explicit Parser(
+    const Schema<Options, Names> &schema,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+  );
+
+  /** @brief Copies a parser, allocating from the same memory resource */
+  Parser(const Parser &other) :
+    resource_ {other.resource_}, options_ {other.options_, resource_},
+    names_ {other.names_, resource_}, flag_ids_ {other.flag_ids_, resource_},
+    flag_names_ {other.flag_names_, resource_}, flags_ {other.flags_},
+    name_filter_ {other.name_filter_}, paths_ {other.paths_, resource_},
+    families_ {other.families_, resource_},
+    family_ids_ {other.family_ids_, resource_}, patterns_ {other.patterns_},
+    interner_ {other.interner_}, limits_ {other.limits_},
+    ignore_unknown_ {other.ignore_unknown_},
+    require_utf8_ {other.require_utf8_} {}
+
+  Parser(Parser &&other) noexcept = default;
+
+  /** @brief Copies the options, the memory resource is not replaced */
+  Parser &operator=(const Parser &other) {
+    options_ = other.options_;
+    names_ = other.names_;
+    flag_ids_ = other.flag_ids_;
+    flag_names_ = other.flag_names_;
+    flags_ = other.flags_;
+    name_filter_ = other.name_filter_;
+    paths_ = other.paths_;
+    // The options can not be assigned, only constructed
+    families_.clear();
+    for (const auto &family : other.families_) families_.push_back(family);
+    family_ids_ = other.family_ids_;
+    patterns_ = other.patterns_;
+    interner_ = other.interner_;
+    limits_ = other.limits_;
+    ignore_unknown_ = other.ignore_unknown_;
+    require_utf8_ = other.require_utf8_;
+    return *this;
+  }
+
+  /** @brief Moves the options, the memory resource is not replaced */
+  Parser &operator=(Parser &&other) {
+    options_ = std::move(other.options_);
+    names_ = std::move(other.names_);
+    flag_ids_ = std::move(other.flag_ids_);
+    flag_names_ = std::move(other.flag_names_);
+    flags_ = std::move(other.flags_);
+    name_filter_ = other.name_filter_;
+    paths_ = std::move(other.paths_);
+    families_.clear();
+    for (auto &family : other.families_) {
+      families_.push_back(std::move(family));
+    }
+    family_ids_ = std::move(other.family_ids_);
+    patterns_ = std::move(other.patterns_);
+    interner_ = other.interner_;
+    limits_ = other.limits_;
+    ignore_unknown_ = other.ignore_unknown_;
+    require_utf8_ = other.require_utf8_;
+    return *this;
+  }
+
+  ~Parser() = default;
 
   // -------------------------------- Adders ------------------------------- //
 
@@ -64,6 +172,22 @@ class Parser {
    */
   Parser &addHelpOption();
 
+  /**
+   * @brief Adds a family of single options, like "--log-level-*", instead of
+   * one option per name. The names of the prototype are patterns with a
+   * single asterisk, and the part of an argument that replaces it is the key
+   * of a member of the family (see OptionFamily).
+   *   The arguments are only matched against the patterns when they are not
+   * the name of an option.
+   *
+   * @tparam CreateFunction The type of the function that creates the option.
+   * @param create_family A function that returns the prototype of the family.
+   * @return The instance of the object that called this method.
+   */
+  template <typename CreateFunction>
+  Parser &addOptionFamily(const CreateFunction &create_family)
+  requires std::is_invocable_r_v<SingleOption, CreateFunction>;
+
   // ------------------------------- Getters ------------------------------- //
 
   /**
@@ -74,7 +198,145 @@ class Parser {
    * @return The value of the option casted to the type provided.
    */
   template <class T>
-  T getValue(const std::string &name) const;
+  T getValue(std::string_view name) const;
+
+  /**
+   * @brief Gets the id of a flag option. The ids go from 0 to the amount of
+   * flags minus one, in the order the flags were added.
+   *
+   * @param name Any of the names of the flag.
+   * @return The position of the flag in the set returned by getFlags.
+   */
+  std::size_t getFlagId(std::string_view name) const;
+
+  /** @brief Gets the first name of the flag with the id provided */
+  inline std::string_view getFlagName(const std::size_t id) const {
+    return flag_names_[id];
+  }
+
+  /**
+   * @brief Gets the state of every flag option, indexed by its id. A flag that
+   * was not specified keeps its default value.
+   */
+  inline const FlagSet &getFlags() const {
+    return flags_;
+  }
+
+  /** @brief Checks if the flag with the id provided is set */
+  inline bool isFlagSet(const std::size_t id) const {
+    return flags_.test(id);
+  }
+
+  /**
+   * @brief Creates a set with the flags provided, to be checked against
+   * getFlags in a single call (see FlagSet::all and FlagSet::any).
+   *
+   * @param names A name of every flag of the group.
+   * @return The set with only the flags of the group.
+   */
+  FlagSet makeFlagGroup(std::initializer_list<std::string_view> names) const;
+
+  /**
+   * @brief Gets a family of options.
+   *
+   * @param pattern Any of the patterns of the family.
+   * @return The family, with the values of every member provided.
+   */
+  const OptionFamily &getFamily(std::string_view pattern) const;
+
+  /**
+   * @brief Gets the options whose names are inside a dotted path. For
+   * example, the subtree "db.pool" has the options "--db.pool",
+   * "--db.pool.size" and "--db.pool.timeout.read", but not "--db.primary".
+   *   Found in logarithmic time, the subtree is only a view of the index of
+   * names kept by the parser, so it is cheap to copy and must not outlive
+   * the parser (nor see options added to it).
+   *
+   * @param path The path of the subtree, without dashes.
+   * @return A view of the options of the subtree.
+   */
+  Subtree getSubtree(std::string_view path) const;
+
+  /** @brief Gets the interner used by the parser (if any) */
+  inline StringInterner *getInterner() const {
+    return interner_;
+  }
+
+  /** @brief Gets the limits enforced while parsing */
+  inline const ParseLimits &getLimits() const {
+    return limits_;
+  }
+
+  /** @brief Checks if the arguments that are not options are ignored */
+  inline bool ignoresUnknownArguments() const {
+    return ignore_unknown_;
+  }
+
+  /** @brief Checks if every string value must be valid UTF-8 */
+  inline bool requiresUtf8() const {
+    return require_utf8_;
+  }
+
+  /** @brief Gets the memory resource used by the parser */
+  inline std::pmr::memory_resource *getMemoryResource() const {
+    return resource_;
+  }
+
+  // ------------------------------- Setters ------------------------------- //
+
+  /**
+   * @brief Stores the string values of the single options in the interner
+   * provided, instead of giving every value its own std::string. The same
+   * interner can be shared by many parsers, even from different threads, and
+   * must outlive all of them. The values can be read as InternedString,
+   * std::string or std::string_view.
+   *
+   * @param interner The interner to use, or nullptr to stop interning.
+   * @return The instance of the object that called this method.
+   */
+  inline Parser &setInterner(StringInterner *interner) {
+    interner_ = interner;
+    return *this;
+  }
+
+  /**
+   * @brief Changes the limits enforced on the arguments parsed. Parsing fails
+   * with ErrorCode::kLimitExceeded as soon as one of them is exceeded.
+   *
+   * @param limits The new limits.
+   * @return The instance of the object that called this method.
+   */
+  inline Parser &setLimits(const ParseLimits &limits) {
+    limits_ = limits;
+    return *this;
+  }
+
+  /**
+   * @brief Makes the parser skip the arguments (or the keys of a query string
+   * or a JSON object) that are not options, instead of failing. Useful to
+   * classify command lines that only share a few options.
+   *
+   * @param ignore Whether the unknown arguments are ignored or not.
+   * @return The instance of the object that called this method.
+   */
+  inline Parser &ignoreUnknownArguments(const bool ignore = true) {
+    ignore_unknown_ = ignore;
+    return *this;
+  }
+
+  /**
+   * @brief Makes every parse check, once all the values are set, that the
+   * values still stored as strings are valid UTF-8. Unlike the validUtf8
+   * constraint of the options, the error reports the position of the first
+   * invalid sequence. Fails with ErrorCode::kConstraintFailed.
+   *
+   * @param require Whether the values must be valid UTF-8 or not.
+   * @return The instance of the object that called this method.
+   */
+  inline Parser &requireUtf8(const bool require = true) {
+    require_utf8_ = require;
+    return *this;
+  }
 
   // -------------------------------- Utility ------------------------------ //
 
@@ -88,16 +350,152 @@ class Parser {
    */
   void parse(unsigned int argc, char *raw_argv[]);
 
+  /**
+   * @brief Parses command line input like parse does, but returns the error
+   * generated instead of throwing it.
+   *
+   * @param argc The amount of arguments provided when executing the program.
+   * @param raw_argv A vector of strings with the arguments.
+   * @return Nothing, or the error generated if the arguments are not valid.
+   */
+  Result<> tryParse(unsigned int argc, char *raw_argv[]);
+
+  /**
+   * @brief Parses a command line stored like /proc/<pid>/cmdline: every
+   * argument (starting with the program name) followed by a NUL character.
+   * The arguments are read from the buffer as they are, without building
+   * an argv (see readCmdline).
+   *
+   * @param cmdline The arguments, each one ended by a NUL character (the
+   * last one may be unterminated).
+   */
+  void parseCmdline(std::string_view cmdline);
+
+  /**
+   * @brief Parses a command line stored like /proc/<pid>/cmdline, like
+   * parseCmdline does, but returns the error generated instead of throwing
+   * it.
+   *
+   * @param cmdline The arguments, each one ended by a NUL character.
+   * @return Nothing, or the error generated if the arguments are not valid.
+   */
+  Result<> tryParseCmdline(std::string_view cmdline);
+
+  /**
+   * @brief Parses the settings of a URL query string, like
+   * "?threads=8&mode=fast&tags=a&tags=b", as if they were provided by
+   * command line. Every key is a name of an option without its dashes, and
+   * the values go through the same transformations and constraints:
+   *   - A flag is set by its key alone, or with the values "true" or "1" (a
+   * flag with the values "false" or "0" keeps its default state).
+   *   - A single option takes the value of its key.
+   *   - A compound option takes the values of every repetition of its key.
+   * The keys and values are percent-decoded, and only copied if they have
+   * something to decode.
+   *
+   * @param query The query string, with or without the leading '?'.
+   */
+  void parseQuery(std::string_view query);
+
+  /**
+   * @brief Parses a query string like parseQuery does, but returns the error
+   * generated instead of throwing it.
+   *
+   * @param query The query string, with or without the leading '?'.
+   * @return Nothing, or the error generated if the settings are not valid.
+   */
+  Result<> tryParseQuery(std::string_view query);
+
+  /**
+   * @brief Parses the settings of a JSON object, like
+   * {"threads": 8, "verbose": true, "tags": ["a", "b"]}, as if they were
+   * provided by command line. Every key is a name of an option without its
+   * dashes, and the values go through the same transformations and
+   * constraints:
+   *   - A flag takes a boolean (a flag set to false keeps its default state).
+   *   - A single option takes a string, a number or a boolean.
+   *   - A compound option takes an array of them, or one of them alone.
+   * An object whose key is not an option holds the options of a dotted path:
+   * {"db": {"host": "x"}} sets the option "--db.host". The values set to null
+   * are skipped, and the strings are only decoded when an option takes them.
+   *
+   * @param json The JSON text, with an object as its only value.
+   */
+  void parseJson(std::string_view json);
+
+  /**
+   * @brief Parses a JSON object like parseJson does, but returns the error
+   * generated instead of throwing it.
+   *
+   * @param json The JSON text, with an object as its only value.
+   * @return Nothing, or the error generated if the settings are not valid.
+   */
+  Result<> tryParseJson(std::string_view json);
+
+  /**
+   * @brief Removes the values set by the previous parses: every option goes
+   * back to its default value, every flag to its default state, and the
+   * families lose their members. The values of a parse are kept by the next
+   * ones (so a JSON file can be overridden by the command line), so a parser
+   * reused for unrelated inputs must be reset between them.
+   */
+  void reset();
+
   /**
    * @brief Shows to the user how to execute the program correctly.
    */
-  std::string usage() const;
+  INPUT_PARSER_COLD std::string usage() const;
+
+  /**
+   * @brief Estimates the memory owned by the parser: the nodes and buckets of
+   * the internal maps and the heap memory of every option, sorted from the
+   * biggest option to the smallest.
+   *
+   * @return A breakdown of the memory used.
+   */
+  INPUT_PARSER_COLD MemoryUsage memoryUsage() const;
 
  private:
+  /** @brief A map that can be searched with any kind of string */
+  template <class T>
+  using StringMap =
+    std::pmr::unordered_map<std::pmr::string, T, StringHash, std::equal_to<>>;
+
+  // The amount of JSON objects that can enclose the options
+  static constexpr std::size_t kMaxJsonDepth = 64;
+
+  // Where the maps and parsing buffers are allocated from.
+  std::pmr::memory_resource *resource_;
   // All the options registered.
-  std::unordered_map<std::string, Option> options_;
+  StringMap<Option> options_;
   // Helper map to get the option by name.
-  std::unordered_map<std::string, std::string> names_;
+  StringMap<std::pmr::string> names_;
+  // The id of every flag, searchable by any of its names.
+  StringMap<std::size_t> flag_ids_;
+  // The first name of every flag, indexed by its id.
+  std::pmr::vector<std::pmr::string> flag_names_;
+  // The state of every flag, indexed by its id.
+  FlagSet flags_;
+  // Rejects most of the arguments that are not names without hashing them.
+  NameFilter name_filter_;
+  // The names with a dot, sorted by their path (see pathLess).
+  std::pmr::vector<std::pmr::string> paths_;
+  // The families of options, in the order they were added.
+  std::pmr::vector<OptionFamily> families_;
+  // The position of every family, searchable by any of its patterns.
+  StringMap<std::size_t> family_ids_;
+  // Matches the arguments against the patterns of every family.
+  PatternMatcher patterns_;
+  // Where the values of the single options are stored (if any).
+  StringInterner *interner_ = nullptr;
+  // The limits enforced on the arguments parsed.
+  ParseLimits limits_;
+  // Whether the arguments that are not options are skipped.
+  bool ignore_unknown_ = false;
+  // Whether the string values must be valid UTF-8.
+  bool require_utf8_ = false;
+  // The time spent setting values during the current parse.
+  std::chrono::nanoseconds value_time_ {};
 
   // ---------------------------- Static Methods --------------------------- //
 
@@ -106,19 +504,163 @@ class Parser {
    *
    * @param option The option to be changed.
    * @param value The value to be assigned to the option.
+   * @return The error generated if the value does not satisfy the constraints.
    */
-  static void setOptionValue(Option &option, const std::any &value);
+  static Result<> setOptionValue(Option &option, const std::any &value);
+
+  // ------------------------------- Limits -------------------------------- //
+
+  /**
+   * @brief Sets a value through the function provided, measuring the time
+   * spent if it is limited.
+   *
+   * @tparam Setter The type of the function that sets the value.
+   * @param set_value A function that sets the value and returns its result.
+   * @return The error generated if the value does not satisfy the constraints
+   * or the time limit was exceeded.
+   */
+  template <class Setter>
+  Result<> setLimitedValue(const Setter &set_value);
+
+  /**
+   * @brief Adds the time spent setting a value to the time of the parse.
+   *
+   * @param spent The time spent setting the value.
+   * @return The error of the time limit exceeded (if it was).
+   */
+  Result<> addValueTime(std::chrono::nanoseconds spent);
+
+  /**
+   * @brief Reads the arguments provided, checking the amount of arguments and
+   * their length. No argument is read further than the limits allow.
+   *
+   * @param argc The amount of arguments provided.
+   * @param raw_argv The arguments.
+   * @return A view of every argument, or the error of the limit exceeded.
+   */
+  Result<std::pmr::vector<std::string_view>>
+  readArguments(unsigned int argc, char *raw_argv[]) const;
+
+  /**
+   * @brief Splits a NUL-separated command line into its arguments, checking
+   * the same limits as readArguments.
+   *
+   * @param cmdline The arguments, each one ended by a NUL character.
+   * @return A view of every argument, or the error of the limit exceeded.
+   */
+  Result<std::pmr::vector<std::string_view>>
+  splitCmdline(std::string_view cmdline) const;
+
+  /**
+   * @brief Sets the options named by the arguments, skipping the first one
+   * (the program name), and checks the options missing.
+   *
+   * @param argv The arguments.
+   * @return Nothing, or the error generated if the arguments are not valid.
+   */
+  Result<> parseArguments(std::span<const std::string_view> argv);
+
+  // -------------------------------- Adders ------------------------------- //
+
+  /**
+   * @brief Registers an option and all its names.
+   *
+   * @param option The option to be added.
+   */
+  void insertOption(Option option);
+
+  /**
+   * @brief Registers a family of options and all its patterns.
+   *
+   * @param prototype The prototype of the family.
+   */
+  void insertFamily(SingleOption prototype);
+
+  /**
+   * @brief Creates the option described by a schema and registers it.
+   *
+   * @param option The option of the schema.
+   * @param names All the names of the option.
+   */
+  void adoptOption(
+    const SchemaOption &option, std::span<const std::string_view> names
+  );
+
+  /**
+   * @brief Gives an id to a flag option and stores its default state.
+   *
+   * @param flag The flag option added.
+   */
+  void addFlag(const FlagOption &flag);
 
   // ------------------------------- Getters ------------------------------- //
 
+  /**
+   * @brief Gives access to any kind of option through its base class. Every
+   * operation common to all the options goes through here, so there is a
+   * single dispatch over the variant instead of one per operation.
+   */
+  static inline const BaseOption &asBase(const Option &option) {
+    return std::visit(
+      [](const auto &opt) -> const BaseOption & { return opt; }, option
+    );
+  }
+
+  /** @brief Gives read-write access to any kind of option (see above) */
+  static inline BaseOption &asBase(Option &option) {
+    return std::visit([](auto &opt) -> BaseOption & { return opt; }, option);
+  }
+
+  /** @brief Gets the path of a name: the name without its leading dashes */
+  static inline std::string_view pathOf(const std::string_view name) {
+    return name.substr(std::min(name.find_first_not_of('-'), name.size()));
+  }
+
+  /**
+   * @brief Compares two paths like strings, but the dots go before any other
+   * character. That way the paths inside a subtree ("db.pool",
+   * "db.pool.size") are never split by another path ("db.pool-old").
+   */
+  static bool pathLess(std::string_view lhs, std::string_view rhs);
+
+  /**
+   * @brief Searches the option named like a key of a query string: the key
+   * preceded by two dashes or, if there is none, by a single dash.
+   *
+   * @param key The name of the option without its dashes.
+   * @return The reference name of the option, or nullptr if none is found.
+   */
+  const std::pmr::string *findKey(std::string_view key) const;
+
+  /**
+   * @brief Reads a JSON object, setting the options named by its keys.
+   *
+   * @param reader The reader, right before the object.
+   * @param prefix The dotted path of the object, with its trailing dot.
+   * @param depth The amount of objects that enclose this one.
+   * @return The error generated if the settings are not valid.
+   */
+  Result<> readJsonObject(
+    JsonReader &reader, const std::string &prefix, std::size_t depth
+  );
+
+  /**
+   * @brief Reads a JSON value, setting it to the option provided.
+   *
+   * @param reader The reader, right before the value.
+   * @param name The reference name of the option.
+   * @return The error generated if the value is not valid.
+   */
+  Result<> readJsonValue(JsonReader &reader, const std::pmr::string &name);
+
   /** @brief Gives readonly access to the option with the provided name */
-  inline const Option &getOption(const std::string &name) const {
-    return options_.at(names_.at(name));
+  inline const Option &getOption(const std::string_view name) const {
+    return options_.find(names_.find(name)->second)->second;
   }
 
   /** @brief Gives read-write access to the option with the provided name */
-  inline Option &getOption(const std::string &name) {
-    return options_.at(names_.at(name));
+  inline Option &getOption(const std::string_view name) {
+    return options_.find(names_.find(name)->second)->second;
   }
 
   // ------------------------------- Checks ------------------------------- //
@@ -129,8 +671,20 @@ class Parser {
    * @param name The name of the possible option.
    * @return Whether the parser registered the option or not.
    */
-  inline bool hasOption(const std::string &name) const {
-    return names_.find(name) != names_.end();
+  inline bool hasOption(const std::string_view name) const {
+    return name_filter_.mayContain(name) && names_.contains(name);
+  }
+
+  /**
+   * @brief Tells if an argument is the name of an option or of a member of a
+   * family of options.
+   *
+   * @param argument The argument to check.
+   * @return Whether the argument is a name or a value.
+   */
+  inline bool isName(const std::string_view argument) const {
+    return hasOption(argument) ||
+           (!patterns_.empty() && patterns_.match(argument).has_value());
   }
 
   /**
@@ -139,7 +693,7 @@ class Parser {
    * @param name The name of the possible option.
    * @return Whether the parser registered the option or not.
    */
-  bool hasFlag(const std::string &name) const;
+  bool hasFlag(std::string_view name) const;
 
   /**
    * @brief Tells if the parser has a single option with the name provided.
@@ -147,7 +701,7 @@ class Parser {
    * @param name The name of the possible option.
    * @return Whether the parser registered the option or not.
    */
-  bool hasSingle(const std::string &name) const;
+  bool hasSingle(std::string_view name) const;
 
   /**
    * @brief Tells if the parser has a compound option with the name provided.
@@ -155,19 +709,31 @@ class Parser {
    * @param name The name of the possible option.
    * @return Whether the parser registered the option or not.
    */
-  bool hasCompound(const std::string &name) const;
+  bool hasCompound(std::string_view name) const;
 
   /**
    * @brief Check if there are options that have not been specified.
-   *  If so, a std::invalid_argument error will be thrown.
+   *
+   * @return An error naming the first option missing (if any).
    */
-  void checkMissingOptions() const;
+  Result<> checkMissingOptions() const;
 
   /**
    * @brief Check if the help option was specified.
-   * If so, display the usage and exit the program.
+   *
+   * @return An error with the usage as message if it was specified.
    */
-  void checkHelpOption() const;
+  Result<> checkHelpOption() const;
+
+  /**
+   * @brief Checks that the values stored as strings are valid UTF-8, if the
+   * parser requires it (see requireUtf8). The options are checked before the
+   * families, and both in a fixed order whatever the order of the map.
+   *
+   * @return The error of the first invalid value found: the option with the
+   * lowest name, or the member of the first family with the lowest key.
+   */
+  Result<> checkUtf8Values() const;
 
   // ------------------------- Individual parsers -------------------------- //
 
@@ -177,8 +743,9 @@ class Parser {
    * opposite of the default value.
    *
    * @param flag_name The name of the option to give the value of true.
+   * @return How many arguments have been read (always 0).
    */
-  void parseFlag(const std::string &flag_name);
+  Result<unsigned int> parseFlag(std::string_view flag_name);
 
   /**
    * @brief Saves the extra argument after the single option.
@@ -188,10 +755,40 @@ class Parser {
    * @param index The index of the single option to parse.
    * @return How many arguments have been read.
    */
-  unsigned int parseSingle(
-    const std::vector<std::string> &arguments, const unsigned int index
+  Result<unsigned int> parseSingle(
+    std::span<const std::string_view> arguments, const unsigned int index
   );
 
+  /**
+   * @brief Sets a flag from a value written as text: "true" and "1" work like
+   * providing the flag, "false" and "0" leave it as it is.
+   *
+   * @param flag_name The name of the flag.
+   * @param state The value provided.
+   * @return The error generated if the value is not valid.
+   */
+  Result<> setFlagState(std::string_view flag_name, std::string_view state);
+
+  /**
+   * @brief Assigns the value of a single option, storing it in the interner
+   * if the parser has one.
+   *
+   * @param option The single option.
+   * @param value The value provided.
+   * @return The error generated if the value is not valid.
+   */
+  Result<> setSingleValue(Option &option, std::string_view value);
+
+  /**
+   * @brief Assigns the values of a compound option, replacing first the glob
+   * patterns by the paths they match if the option expands them.
+   *
+   * @param option The compound option.
+   * @param values The values provided.
+   * @return The error generated if the values are not valid.
+   */
+  Result<> setCompoundValues(Option &option, const StringList &values);
+
   /**
    * @brief Reads all the extra arguments provided after the compound option.
    *   Checks if the arguments were supplied and are not another option
@@ -201,35 +798,169 @@ class Parser {
    * @param index The index of the compound option to parse.
    * @return How many arguments have been read.
    */
-  unsigned int parseCompound(
-    const std::vector<std::string> &arguments, const unsigned int index
+  Result<unsigned int> parseCompound(
+    std::span<const std::string_view> arguments, const unsigned int index
   );
+
+  /**
+   * @brief Saves the extra argument after a member of a family of options.
+   *
+   * @param arguments All the arguments provided by command line.
+   * @param index The index of the member to parse.
+   * @param member The family and the key of the member.
+   * @return How many arguments have been read.
+   */
+  Result<unsigned int> parseFamily(
+    std::span<const std::string_view> arguments, const unsigned int index,
+    const PatternMatch &member
+  );
+};
+
+/**
+ * @brief The options of a parser inside a dotted path (see
+ * Parser::getSubtree). It only holds the parser and the range of its names,
+ * so it can be given to every subsystem instead of the whole parser.
+ */
+class Parser::Subtree {
+ public:
+  using const_iterator = std::pmr::vector<std::pmr::string>::const_iterator;
+
+  /** @brief Gets the amount of names inside the subtree */
+  inline std::size_t size() const {
+    return static_cast<std::size_t>(end_ - begin_);
+  }
+
+  /** @brief Checks if there are no names inside the subtree */
+  inline bool empty() const {
+    return begin_ == end_;
+  }
+
+  /** @brief Gets the first name of the subtree, sorted by path */
+  inline const_iterator begin() const {
+    return begin_;
+  }
+
+  /** @brief Gets the end of the names of the subtree */
+  inline const_iterator end() const {
+    return end_;
+  }
+
+  /**
+   * @brief Searches an option of the subtree.
+   *
+   * @param relative_path The path of the option inside the subtree (like
+   * "size" in the subtree "db.pool"), or empty for the subtree itself.
+   * @return The name of the option (if found).
+   */
+  std::optional<std::string_view> find(std::string_view relative_path) const;
+
+  /** @brief Checks if the subtree has an option (see find) */
+  inline bool contains(const std::string_view relative_path) const {
+    return find(relative_path).has_value();
+  }
+
+  /**
+   * @brief Gets the value of an option of the subtree.
+   *
+   * @tparam T The type of the value to be returned.
+   * @param relative_path The path of the option inside the subtree.
+   * @return The value of the option casted to the type provided.
+   */
+  template <class T>
+  T getValue(std::string_view relative_path) const;
+
+  /**
+   * @brief Gets a subtree inside this one.
+   *
+   * @param relative_path The path of the subtree inside this one.
+   * @return A view of the options of the inner subtree.
+   */
+  Subtree getSubtree(std::string_view relative_path) const;
+
+ private:
+  friend class Parser;
+
+  // The parser that has the options
+  const Parser *parser_;
+  // The length of the path of the subtree
+  std::size_t depth_;
+  // The range of names inside the subtree
+  const_iterator begin_;
+  const_iterator end_;
+
+  /**
+   * @brief Gets a function that removes the path of the subtree (and the dot
+   * after it) from the names inside it.
+   */
+  inline auto relative() const {
+    return [depth = depth_](const std::pmr::string &name) {
+      const auto path = pathOf(name);
+      return path.substr(std::min(depth == 0 ? 0 : depth + 1, path.size()));
+    };
+  }
+
+  Subtree(
+    const Parser *parser, const std::size_t depth, const const_iterator begin,
+    const const_iterator end
+  ) : parser_ {parser}, depth_ {depth}, begin_ {begin}, end_ {end} {}
 };
 
+template <class T>
+T Parser::Subtree::getValue(const std::string_view relative_path) const {
+  const auto name = find(relative_path);
+  if (!name) {
+    raiseError(
+      "The option is not inside the subtree", ErrorCode::kUnknownOption
+    );
+  }
+  return parser_->getValue<T>(*name);
+}
+
+template <std::size_t Options, std::size_t Names>
+Parser::Parser(
+  const Schema<Options, Names> &schema, std::pmr::memory_resource *resource
+) : Parser(resource) {
+  options_.reserve(Options);
+  names_.reserve(Names);
+  for (const auto &option : schema.options()) {
+    adoptOption(option, schema.namesOf(option));
+  }
+}
+
 template <typename CreateFunction>
 Parser &Parser::addOption(const CreateFunction &create_option)
 requires std::is_invocable_r_v<Option, CreateFunction>
 {
-  const auto option = create_option();
-  const auto &reference_name = option.getNames().front();
-  for (const auto &name : option.getNames()) {
-    if (hasOption(name)) throw std::invalid_argument("Option already exists!");
-    names_[name] = reference_name;
-  }
-  options_.emplace(reference_name, option);
+  insertOption(create_option());
   return *this;
 }
 
+template <typename CreateFunction>
+Parser &Parser::addOptionFamily(const CreateFunction &create_family)
+requires std::is_invocable_r_v<SingleOption, CreateFunction>
+{
+  insertFamily(create_family());
+  return *this;
+}
+
+template <class Setter>
+Result<> Parser::setLimitedValue(const Setter &set_value) {
+  if (!limits_.limitsValueTime()) return set_value();
+  const auto start = std::chrono::steady_clock::now();
+  auto result = set_value();
+  if (!result) return result;
+  return addValueTime(std::chrono::steady_clock::now() - start);
+}
+
 template <class T>
-T Parser::getValue(const std::string &name) const {
+T Parser::getValue(const std::string_view name) const {
   if (!hasOption(name)) {
-    throw ParsingError(
-      "The option " + name + " was not assigned at the parser"
-    );
+    raiseError(ParsingError(
+      "The option " + std::string(name) + " was not assigned at the parser",
+      ErrorCode::kUnknownOption
+    ));
   }
-  return std::visit(
-    [](auto &&opt) { return opt.template getValue<T>(); }, getOption(name)
-  );
+  return asBase(getOption(name)).template getValue<T>();
 }
 
 }  // namespace input_parser
@@ -7,16 +7,46 @@
  *
  * @brief File containing the description of a error generated by the parser,
  * commonly when the arguments provided are not valid or are missing.
+ *   When the library is built with INPUT_PARSER_NO_EXCEPTIONS the errors are
+ * returned (see Result) or, where that is not possible, given to the error
+ * handler installed before aborting the program.
  *
  */
 
 #ifndef _PARSING_ERROR_HPP_
 #define _PARSING_ERROR_HPP_
 
+#include <expected>
 #include <stdexcept>
 
+#include <input_parser/config.hpp>
+
 namespace input_parser {
 
+/** @brief The kind of error ocurred */
+enum class ErrorCode {
+  // The arguments provided do not correspond to any option
+  kInvalidArguments,
+  // An option was provided without its extra arguments
+  kMissingArgument,
+  // A required option was not provided
+  kMissingOption,
+  // A value does not satisfy a constraint of its option
+  kConstraintFailed,
+  // The help option was provided, the message is the usage
+  kHelpRequested,
+  // The option requested was not added to the parser
+  kUnknownOption,
+  // An option with the same name was already added
+  kDuplicateOption,
+  // The value was requested as a type different from the one stored
+  kBadValueType,
+  // The default value was requested but there is none
+  kNoDefaultValue,
+  // The arguments exceed one of the limits of the parser (see ParseLimits)
+  kLimitExceeded,
+};
+
 /** @brief Represents an error ocurred parsing a program arguments */
 class ParsingError : public std::invalid_argument {
  public:
@@ -25,11 +55,63 @@ class ParsingError : public std::invalid_argument {
    * constructor
    *
    * @param message The message to be shown.
+   * @param code The kind of error ocurred.
    */
-  explicit ParsingError(const std::string &message) :
-    std::invalid_argument(message) {}
+  explicit ParsingError(
+    const std::string &message,
+    const ErrorCode code = ErrorCode::kInvalidArguments
+  ) : std::invalid_argument(message), code_ {code} {}
+
+  /** @brief Gets the kind of error ocurred */
+  inline ErrorCode code() const {
+    return code_;
+  }
+
+ private:
+  // The kind of error ocurred
+  ErrorCode code_;
 };
 
+/**
+ * @brief The value returned by the operations that can fail without throwing
+ * an exception: the value computed or the error ocurred.
+ */
+template <class T = void>
+using Result = std::expected<T, ParsingError>;
+
+/** @brief A function that receives the errors that can not be returned */
+using ErrorHandler = void (*)(const ParsingError &error);
+
+/**
+ * @brief Installs a function that will receive every error that can not be
+ * returned as a Result (for example the ones generated by Parser::parse or
+ * Parser::getValue). After the handler returns, the error is thrown or, if
+ * exceptions are disabled, the program is aborted.
+ *
+ * @param handler The new handler, nullptr to remove the current one.
+ * @return The handler that was installed before.
+ */
+ErrorHandler setErrorHandler(ErrorHandler handler);
+
+/**
+ * @brief Reports an error that can not be returned. Calls the error handler
+ * and then throws the error (or aborts if exceptions are disabled).
+ *
+ * @param error The error ocurred.
+ */
+[[noreturn]] INPUT_PARSER_COLD void raiseError(const ParsingError &error);
+
+/**
+ * @brief Creates an error and reports it like the function above. Used from
+ * templates, so the code that builds the error is not repeated in every one
+ * of their instantiations.
+ *
+ * @param message The explanation of the error.
+ * @param code The kind of error.
+ */
+[[noreturn]] INPUT_PARSER_COLD void
+raiseError(const char *message, ErrorCode code);
+
 }  // namespace input_parser
 
 #endif  // _PARSING_ERROR_HPP_
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+ * @file pattern_matcher.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a matcher of name patterns, like
+ * "--log-level-*" or "--weight.*". The part of the name that replaces the
+ * asterisk is captured as a key.
+ *   The prefixes of the patterns (what comes before the asterisk) are kept in
+ * a trie stored in a single vector, so a name is matched against all of them
+ * in a single pass over its characters.
+ *
+ */
+
+#ifndef _INPUT_PATTERN_MATCHER_HPP_
+#define _INPUT_PATTERN_MATCHER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace input_parser {
+
+/** @brief A name matched by a pattern */
+struct PatternMatch {
+  // The id given to the pattern when it was added
+  std::size_t id;
+  // The part of the name that replaces the asterisk
+  std::string_view key;
+};
+
+/**
+ * @brief Matches names against a set of patterns with a single asterisk.
+ * When several patterns match a name, the one with the longest prefix wins.
+ */
+class PatternMatcher {
+ public:
+  /** @brief Creates a matcher without patterns */
+  PatternMatcher() : nodes_(1) {}
+
+  /**
+   * @brief Checks if a string is a pattern: it must have a single asterisk.
+   *
+   * @param pattern The string to check.
+   * @return Whether the string can be added to a matcher or not.
+   */
+  static inline bool isPattern(const std::string_view pattern) {
+    const auto asterisk = pattern.find('*');
+    return asterisk != std::string_view::npos &&
+           pattern.find('*', asterisk + 1) == std::string_view::npos;
+  }
+
+  /**
+   * @brief Adds a pattern to the matcher (see isPattern).
+   *
+   * @param pattern The pattern to be added.
+   * @param id The id returned when a name matches the pattern.
+   */
+  void add(std::string_view pattern, std::size_t id);
+
+  /**
+   * @brief Searches the pattern that matches a name. The key captured can not
+   * be empty.
+   *
+   * @param name The name to match.
+   * @return The id of the pattern and the key captured (if any matches).
+   */
+  std::optional<PatternMatch> match(std::string_view name) const;
+
+  /** @brief Checks if no pattern was added */
+  inline bool empty() const {
+    return nodes_.size() == 1 && nodes_.front().endings.empty();
+  }
+
+ private:
+  /** @brief A prefix of some pattern */
+  struct Node {
+    // The nodes that extend the prefix by one character, sorted by it
+    std::vector<std::pair<char, std::uint32_t>> children;
+    // The suffix and the id of the patterns whose prefix ends here
+    std::vector<std::pair<std::string, std::size_t>> endings;
+  };
+
+  // The trie of prefixes, the root is the empty prefix
+  std::vector<Node> nodes_;
+
+  /** @brief Gets the node that extends another one with a character */
+  std::optional<std::uint32_t>
+  child(std::uint32_t node, char character) const;
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_PATTERN_MATCHER_HPP_
\ No newline at end of file
@@ -0,0 +1,37 @@
+/**
+ * @file percent_decoding.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the decoding of the keys and values of a URL query
+ * string ("%2F" stands for "/" and "+" for a space), used by
+ * Parser::parseQuery.
+ *
+ */
+
+#ifndef _INPUT_PERCENT_DECODING_HPP_
+#define _INPUT_PERCENT_DECODING_HPP_
+
+#include <string>
+#include <string_view>
+
+#include <input_parser/parsing_error.hpp>
+
+namespace input_parser {
+
+/**
+ * @brief Decodes a component of a query string in a single pass. The text is
+ * only copied if it has something to decode, otherwise it is returned as is.
+ *
+ * @param text The component to decode.
+ * @param buffer Where the decoded text is written (if needed).
+ * @return The text decoded, or an error if an escape sequence is malformed.
+ */
+Result<std::string_view>
+percentDecode(std::string_view text, std::string &buffer);
+
+}  // namespace input_parser
+
+#endif  // _INPUT_PERCENT_DECODING_HPP_
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+ * @file record_stream.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the functions that read the
+ * values of a compound option from a stream (see
+ * CompoundOption::streamValues).
+ *   The records are split straight from large reads into the list of
+ * values, and regular files are mapped instead of read, so the values are
+ * never staged as arguments and can go far beyond ARG_MAX.
+ *
+ */
+
+#ifndef _INPUT_RECORD_STREAM_HPP_
+#define _INPUT_RECORD_STREAM_HPP_
+
+#include <optional>
+#include <string_view>
+
+#include <input_parser/parse_limits.hpp>
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/string_list.hpp>
+
+namespace input_parser {
+
+/**
+ * @brief Gets the file descriptor named by a value: "-" for the standard
+ * input, or "fd:N" for the descriptor N.
+ *
+ * @param source The value given to the option.
+ * @return The descriptor, or nothing if the value does not name one.
+ */
+std::optional<int> streamDescriptor(std::string_view source);
+
+/**
+ * @brief Reads every record of a file descriptor until its end. The empty
+ * records are skipped, and the descriptor is not closed.
+ *
+ * @param descriptor The file descriptor to read from.
+ * @param delimiter The character that ends every record ('\0' or '\n').
+ * @param records Where the records are added.
+ * @param limits The limits on the amount of records and their length.
+ * @return Nothing, or the error generated if the stream could not be read or
+ * a limit was exceeded.
+ */
+Result<> readRecords(
+  int descriptor, char delimiter, StringList &records,
+  const ParseLimits &limits
+);
+
+}  // namespace input_parser
+
+#endif  // _INPUT_RECORD_STREAM_HPP_
\ No newline at end of file
@@ -0,0 +1,280 @@
+/**
+ * @file schema.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a schema: the options of a
+ * parser (their kind and names) known at compile time.
+ *   Every schema is built during the compilation, so a duplicated or
+ * malformed name stops the build instead of failing when the program starts.
+ * A parser can be created from a schema (see Parser).
+ *
+ */
+
+#ifndef _INPUT_SCHEMA_HPP_
+#define _INPUT_SCHEMA_HPP_
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace input_parser {
+
+/** @brief The kinds of option a parser can have */
+enum class OptionKind { kFlag, kSingle, kCompound };
+
+/** @brief An option of a schema */
+struct SchemaOption {
+  // The kind of the option
+  OptionKind kind;
+  // The position of the first name of the option (see Schema::declaredNames)
+  std::size_t first_name;
+  // The amount of names of the option
+  std::size_t name_count;
+  // Short explanation of what the option does
+  std::string_view description;
+  // Indicates if the option is required
+  bool required;
+};
+
+/** @brief A name of a schema along with the option it belongs to */
+struct SchemaName {
+  // The name itself
+  std::string_view name;
+  // The position of the option in the schema
+  std::size_t option;
+};
+
+/**
+ * @brief Checks if a name can be used by an option: it must start with a dash
+ * followed by something other than dashes or whitespaces, like "-n" or
+ * "--name".
+ *
+ * @param name The name to check.
+ * @return Whether the name is valid or not.
+ */
+constexpr bool isValidOptionName(const std::string_view name) {
+  const auto dashes = std::min(name.find_first_not_of('-'), name.size());
+  if (dashes == 0 || dashes > 2 || dashes == name.size()) return false;
+  return std::ranges::none_of(name, [](const char character) {
+    return character == ' ' || character == '\t' || character == '\n' ||
+           character == '=';
+  });
+}
+
+namespace detail {
+
+/**
+ * @brief Reports a mistake found while building a schema. It is not constexpr
+ * on purpose: reaching it during the compilation stops the build, and the
+ * compiler shows the call along with the message.
+ */
+inline void schemaError(const char *) {}
+
+}  // namespace detail
+
+/**
+ * @brief The options of a parser known at compile time. Every method returns
+ * a new schema, and all of them are consteval:
+ *
+ * ```cpp
+ * constexpr auto schema = input_parser::Schema()
+ *   .flag("-v", "--verbose").describe("Shows every step")
+ *   .single("-o", "--output")
+ *   .compound("-i", "--inputs").optional();
+ * ```
+ *
+ * @tparam Options The amount of options of the schema.
+ * @tparam Names The amount of names of all the options.
+ */
+template <std::size_t Options = 0, std::size_t Names = 0>
+class Schema {
+ public:
+  /** @brief Creates an empty schema */
+  consteval Schema() = default;
+
+  // -------------------------------- Adders ------------------------------- //
+
+  /**
+   * @brief Adds a flag option, which is not required and false by default.
+   *
+   * @param name The name of the option.
+   * @param extra_names Extra names that the option can be recognized by.
+   * @return The schema with the option added.
+   */
+  consteval auto flag(
+    const std::string_view name,
+    const std::convertible_to<std::string_view> auto... extra_names
+  ) const {
+    return add<1 + sizeof...(extra_names)>(
+      OptionKind::kFlag, false, {name, std::string_view(extra_names)...}
+    );
+  }
+
+  /**
+   * @brief Adds a single option, which is required.
+   *
+   * @param name The name of the option.
+   * @param extra_names Extra names that the option can be recognized by.
+   * @return The schema with the option added.
+   */
+  consteval auto single(
+    const std::string_view name,
+    const std::convertible_to<std::string_view> auto... extra_names
+  ) const {
+    return add<1 + sizeof...(extra_names)>(
+      OptionKind::kSingle, true, {name, std::string_view(extra_names)...}
+    );
+  }
+
+  /**
+   * @brief Adds a compound option, which is required.
+   *
+   * @param name The name of the option.
+   * @param extra_names Extra names that the option can be recognized by.
+   * @return The schema with the option added.
+   */
+  consteval auto compound(
+    const std::string_view name,
+    const std::convertible_to<std::string_view> auto... extra_names
+  ) const {
+    return add<1 + sizeof...(extra_names)>(
+      OptionKind::kCompound, true, {name, std::string_view(extra_names)...}
+    );
+  }
+
+  // ------------------------------- Setters ------------------------------- //
+
+  /**
+   * @brief Assigns a description to the last option added.
+   *
+   * @param description The new description.
+   * @return The schema with the description assigned.
+   */
+  consteval Schema describe(const std::string_view description) const
+  requires(Options > 0)
+  {
+    auto schema = *this;
+    schema.options_.back().description = description;
+    return schema;
+  }
+
+  /**
+   * @brief Makes the last option added not required.
+   *
+   * @return The schema with the option changed.
+   */
+  consteval Schema optional() const
+  requires(Options > 0)
+  {
+    auto schema = *this;
+    schema.options_.back().required = false;
+    return schema;
+  }
+
+  // ------------------------------- Getters ------------------------------- //
+
+  /** @brief Gets the options, in the order they were added */
+  constexpr std::span<const SchemaOption> options() const {
+    return options_;
+  }
+
+  /** @brief Gets the names of every option, in the order they were added */
+  constexpr std::span<const std::string_view> declaredNames() const {
+    return declared_names_;
+  }
+
+  /** @brief Gets the names of the option provided, in the order added */
+  constexpr std::span<const std::string_view>
+  namesOf(const SchemaOption &option) const {
+    return declaredNames().subspan(option.first_name, option.name_count);
+  }
+
+  /**
+   * @brief Gets the table of names sorted alphabetically, along with the
+   * option each one belongs to. Computed during the compilation.
+   */
+  constexpr std::span<const SchemaName> names() const {
+    return names_;
+  }
+
+  /**
+   * @brief Searches an option by any of its names.
+   *
+   * @param name The name of the option.
+   * @return The position of the option (if found).
+   */
+  constexpr std::optional<std::size_t> find(const std::string_view name
+  ) const {
+    const auto found =
+      std::ranges::lower_bound(names_, name, {}, &SchemaName::name);
+    if (found == names_.end() || found->name != name) return std::nullopt;
+    return found->option;
+  }
+
+ private:
+  template <std::size_t, std::size_t>
+  friend class Schema;
+
+  // The options of the schema
+  std::array<SchemaOption, Options> options_ {};
+  // The names of the options, in the order they were added
+  std::array<std::string_view, Names> declared_names_ {};
+  // The names of the options, sorted alphabetically
+  std::array<SchemaName, Names> names_ {};
+
+  /**
+   * @brief Creates a copy of the schema with a new option, checking that its
+   * names are valid and not used by any other option.
+   */
+  template <std::size_t Count>
+  consteval Schema<Options + 1, Names + Count> add(
+    const OptionKind kind, const bool required,
+    const std::array<std::string_view, Count> &new_names
+  ) const {
+    Schema<Options + 1, Names + Count> schema;
+    for (std::size_t index = 0; index < Count; ++index) {
+      const auto name = new_names[index];
+      if (!isValidOptionName(name)) {
+        detail::schemaError("Malformed option name");
+      }
+      if (const auto option = find(name)) {
+        if (options_[*option].kind != kind) {
+          detail::schemaError("The name is used by an option of other kind");
+        }
+        detail::schemaError("Option already exists!");
+      }
+      for (std::size_t other = 0; other < index; ++other) {
+        if (new_names[other] == name) {
+          detail::schemaError("Option already exists!");
+        }
+      }
+    }
+    std::ranges::copy(options_, schema.options_.begin());
+    schema.options_.back() = {
+      .kind = kind,
+      .first_name = Names,
+      .name_count = Count,
+      .description = {},
+      .required = required,
+    };
+    std::ranges::copy(declared_names_, schema.declared_names_.begin());
+    std::ranges::copy(new_names, schema.declared_names_.begin() + Names);
+    std::ranges::copy(names_, schema.names_.begin());
+    for (std::size_t index = 0; index < Count; ++index) {
+      schema.names_[Names + index] = {new_names[index], Options};
+    }
+    std::ranges::sort(schema.names_, {}, &SchemaName::name);
+    return schema;
+  }
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_SCHEMA_HPP_
\ No newline at end of file
@@ -0,0 +1,37 @@
+/**
+ * @file string_hash.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the hash used by the maps of the
+ * parser, which allows looking up any kind of string without converting it.
+ *
+ */
+
+#ifndef _INPUT_STRING_HASH_HPP_
+#define _INPUT_STRING_HASH_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace input_parser {
+
+/**
+ * @brief Transparent hash for strings. Used along with std::equal_to<> lets
+ * an unordered map be searched with std::string, std::pmr::string,
+ * std::string_view or const char* keys without creating temporary strings.
+ */
+struct StringHash {
+  using is_transparent = void;
+
+  inline std::size_t operator()(const std::string_view str) const noexcept {
+    return std::hash<std::string_view> {}(str);
+  }
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_STRING_HASH_HPP_
\ No newline at end of file
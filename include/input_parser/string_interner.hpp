@@ -0,0 +1,153 @@
+/**
+ * @file string_interner.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a string interner: a store where
+ * every distinct string is kept only once.
+ *   Parsers given an interner (see Parser::setInterner) store the values of
+ * their single options there, so the same value repeated in many parsed
+ * command lines uses the memory of a single string.
+ *
+ */
+
+#ifndef _INPUT_STRING_INTERNER_HPP_
+#define _INPUT_STRING_INTERNER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <input_parser/string_hash.hpp>
+
+namespace input_parser {
+
+class StringInterner;
+
+/**
+ * @brief A string stored in a StringInterner. It is only a view of the
+ * string along with its symbol id: two strings of the same interner are
+ * equal if and only if their ids are equal.
+ */
+class InternedString {
+ public:
+  /** @brief Creates an empty string that belongs to no interner */
+  InternedString() = default;
+
+  /** @brief Gives read-only access to the characters of the string */
+  inline std::string_view view() const {
+    return view_;
+  }
+
+  /** @brief Gets the id of the string, unique inside its interner */
+  inline std::uint32_t id() const {
+    return id_;
+  }
+
+  /** @brief Gets the interner that stores the string */
+  inline const StringInterner *interner() const {
+    return interner_;
+  }
+
+  inline operator std::string_view() const {
+    return view_;
+  }
+
+  /** @brief Compares the ids, or the characters if the interners differ */
+  friend inline bool
+  operator==(const InternedString &lhs, const InternedString &rhs) {
+    if (lhs.interner_ == rhs.interner_) return lhs.id_ == rhs.id_;
+    return lhs.view_ == rhs.view_;
+  }
+
+ private:
+  friend class StringInterner;
+
+  // The characters, owned by the interner
+  std::string_view view_;
+  // The interner that stores the string
+  const StringInterner *interner_ = nullptr;
+  // The symbol id of the string
+  std::uint32_t id_ = 0;
+
+  InternedString(
+    const std::string_view view, const StringInterner *interner,
+    const std::uint32_t id
+  ) : view_ {view}, interner_ {interner}, id_ {id} {}
+};
+
+/**
+ * @brief Keeps a single immutable copy of every string added. Strings can be
+ * added from many threads at the same time, and they live as long as the
+ * interner does.
+ */
+class StringInterner {
+ public:
+  StringInterner() = default;
+
+  StringInterner(const StringInterner &) = delete;
+  StringInterner &operator=(const StringInterner &) = delete;
+
+  // -------------------------------- Adders ------------------------------- //
+
+  /**
+   * @brief Gets the stored copy of a string, adding it if it is new.
+   *
+   * @param value The string to be interned.
+   * @return The string stored, with its symbol id.
+   */
+  InternedString intern(std::string_view value);
+
+  // ------------------------------- Getters ------------------------------- //
+
+  /**
+   * @brief Gets the string with the symbol id provided.
+   *
+   * @param id The id of a string returned by intern.
+   * @return The characters of the string.
+   */
+  std::string_view view(std::uint32_t id) const;
+
+  /** @brief Gets the amount of distinct strings stored */
+  std::size_t size() const;
+
+  /** @brief Gets the amount of characters stored, adding up every string */
+  std::size_t characters() const;
+
+ private:
+  // The strings are split among independent shards, so threads interning
+  // different strings rarely wait for each other
+  static constexpr std::uint32_t kShards = 16;
+
+  /** @brief The strings whose hash falls in the same shard */
+  struct Shard {
+    // Locks the shard while adding or reading strings
+    mutable std::mutex mutex;
+    // Where the characters and the nodes of the map are allocated from
+    std::pmr::monotonic_buffer_resource arena;
+    // The position of every string in the list of strings
+    std::pmr::unordered_map<
+      std::string_view, std::uint32_t, StringHash, std::equal_to<>>
+      ids {&arena};
+    // The strings, in the order they were added
+    std::vector<std::string_view> strings;
+    // The amount of characters stored
+    std::size_t characters = 0;
+  };
+
+  // All the shards of the interner
+  std::array<Shard, kShards> shards_;
+};
+
+}  // namespace input_parser
+
+#endif  // _INPUT_STRING_INTERNER_HPP_
\ No newline at end of file
@@ -0,0 +1,210 @@
+/**
+ * @file string_list.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a compact list of strings, used
+ * to store the values of the compound options. All the characters are kept
+ * in a single buffer, so the whole list needs two allocations no matter how
+ * many elements it has.
+ *
+ */
+
+#ifndef _INPUT_STRING_LIST_HPP_
+#define _INPUT_STRING_LIST_HPP_
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace input_parser {
+
+/**
+ * @brief A list of strings stored contiguously: one buffer with all the
+ * characters and the offset where each element ends. The elements are
+ * accessed as std::string_view.
+ */
+class StringList {
+ public:
+  class Iterator;
+
+  using value_type = std::string_view;
+  using size_type = std::size_t;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  /** @brief Creates an empty list */
+  StringList() = default;
+
+  /**
+   * @brief Creates a list with a copy of the strings provided.
+   *
+   * @param values The strings to be copied.
+   */
+  explicit StringList(const std::vector<std::string> &values);
+
+  // -------------------------------- Adders ------------------------------- //
+
+  /**
+   * @brief Reserves memory, so no reallocation is made while adding strings.
+   *
+   * @param count The amount of strings that will be stored.
+   * @param characters The sum of the sizes of all those strings.
+   */
+  void reserve(size_type count, size_type characters);
+
+  /**
+   * @brief Adds a copy of the string provided to the end of the list.
+   *
+   * @param value The string to be added.
+   */
+  void push_back(std::string_view value);
+
+  // ------------------------------- Getters ------------------------------- //
+
+  /** @brief Gets the amount of strings stored */
+  inline size_type size() const {
+    return ends_.size();
+  }
+
+  /** @brief Checks if the list has no strings */
+  inline bool empty() const {
+    return ends_.empty();
+  }
+
+  /** @brief Gives read-only access to the string at the position provided */
+  inline std::string_view operator[](const size_type index) const {
+    const auto begin = index == 0 ? 0 : ends_[index - 1];
+    return std::string_view(characters_).substr(begin, ends_[index] - begin);
+  }
+
+  /** @brief Gets the characters of all the strings, one after another */
+  inline std::string_view characters() const {
+    return characters_;
+  }
+
+  /** @brief Gets the heap memory owned by the list (in bytes) */
+  inline size_type capacityBytes() const {
+    return characters_.capacity() + ends_.capacity() * sizeof(size_type);
+  }
+
+  Iterator begin() const;
+
+  Iterator end() const;
+
+  // -------------------------------- Utility ------------------------------ //
+
+  /** @brief Copies every string into its own std::string */
+  std::vector<std::string> toVector() const;
+
+  bool operator==(const StringList &other) const = default;
+
+ private:
+  // The characters of all the strings
+  std::string characters_;
+  // The position of the buffer where each string ends
+  std::vector<size_type> ends_;
+};
+
+/** @brief Random access iterator over the strings of a StringList */
+class StringList::Iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::string_view;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::string_view;
+
+  Iterator() = default;
+
+  Iterator(const StringList *list, const difference_type index) :
+    list_ {list}, index_ {index} {}
+
+  inline std::string_view operator*() const {
+    return (*list_)[static_cast<size_type>(index_)];
+  }
+
+  inline std::string_view operator[](const difference_type offset) const {
+    return (*list_)[static_cast<size_type>(index_ + offset)];
+  }
+
+  inline Iterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  inline Iterator operator++(int) {
+    auto copy = *this;
+    ++index_;
+    return copy;
+  }
+
+  inline Iterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  inline Iterator operator--(int) {
+    auto copy = *this;
+    --index_;
+    return copy;
+  }
+
+  inline Iterator &operator+=(const difference_type offset) {
+    index_ += offset;
+    return *this;
+  }
+
+  inline Iterator &operator-=(const difference_type offset) {
+    index_ -= offset;
+    return *this;
+  }
+
+  friend inline Iterator operator+(Iterator it, const difference_type offset) {
+    return it += offset;
+  }
+
+  friend inline Iterator operator+(const difference_type offset, Iterator it) {
+    return it += offset;
+  }
+
+  friend inline Iterator operator-(Iterator it, const difference_type offset) {
+    return it -= offset;
+  }
+
+  friend inline difference_type
+  operator-(const Iterator &lhs, const Iterator &rhs) {
+    return lhs.index_ - rhs.index_;
+  }
+
+  friend inline bool operator==(const Iterator &lhs, const Iterator &rhs) {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend inline std::strong_ordering
+  operator<=>(const Iterator &lhs, const Iterator &rhs) {
+    return lhs.index_ <=> rhs.index_;
+  }
+
+ private:
+  // The list being iterated
+  const StringList *list_ = nullptr;
+  // The position of the string pointed
+  difference_type index_ = 0;
+};
+
+inline StringList::Iterator StringList::begin() const {
+  return {this, 0};
+}
+
+inline StringList::Iterator StringList::end() const {
+  return {this, static_cast<Iterator::difference_type>(size())};
+}
+
+}  // namespace input_parser
+
+#endif  // _INPUT_STRING_LIST_HPP_
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+ * @file utf8.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the UTF-8 validation of the
+ * values of the options (see validUtf8 and Parser::requireUtf8).
+ *   The runs of ASCII characters, most of the text of a value, are skipped
+ * 32 bytes at a time with AVX2 when the processor supports it, 16 bytes at a
+ * time with SSE2 otherwise, and 8 bytes at a time on other architectures.
+ * Only the multi-byte sequences are decoded one by one.
+ *
+ */
+
+#ifndef _INPUT_UTF8_HPP_
+#define _INPUT_UTF8_HPP_
+
+#include <any>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace input_parser {
+
+/** @brief The position of an invalid UTF-8 sequence inside an option */
+struct Utf8Error {
+  // The position of the value that has the sequence (always 0 for a single)
+  std::size_t value;
+  // The position of the first byte of the sequence inside the value
+  std::size_t offset;
+};
+
+/**
+ * @brief Searches the first invalid UTF-8 sequence of a text: a malformed,
+ * overlong or truncated sequence, or an encoded surrogate.
+ *
+ * @param text The text to validate.
+ * @return The position of the first byte of the sequence, or nothing if the
+ * text is valid.
+ */
+std::optional<std::size_t> findInvalidUtf8(std::string_view text);
+
+/**
+ * @brief Searches the first invalid UTF-8 sequence of a value stored by an
+ * option: a std::string, an InternedString, a StringList or a
+ * std::vector<std::string>. The elements of a StringList are validated in a
+ * single pass over all their characters.
+ *
+ * @param value The value to validate.
+ * @return The position of the sequence, or nothing if the value is valid or
+ * not a string.
+ */
+std::optional<Utf8Error> findInvalidUtf8Value(const std::any &value);
+
+/** @brief Checks if a text is valid UTF-8 */
+inline bool isValidUtf8(const std::string_view text) {
+  return !findInvalidUtf8(text).has_value();
+}
+
+}  // namespace input_parser
+
+#endif  // _INPUT_UTF8_HPP_
\ No newline at end of file
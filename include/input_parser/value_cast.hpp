@@ -0,0 +1,101 @@
+/**
+ * @file value_cast.hpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the function used to read the values stored by the
+ * options. Some values are stored with a compact representation (like the
+ * StringList of the compound options), so they can be read either as the
+ * compact type or as the type users expect.
+ *
+ */
+
+#ifndef _INPUT_VALUE_CAST_HPP_
+#define _INPUT_VALUE_CAST_HPP_
+
+#include <any>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/string_interner.hpp>
+#include <input_parser/string_list.hpp>
+
+namespace input_parser {
+
+/**
+ * @brief Reads a value stored by an option as the type provided.
+ *   A StringList can be read as a std::vector<std::string> and vice versa.
+ * An InternedString can be read as a std::string or a std::string_view, and
+ * so can a std::string.
+ * If the value has another type, a ParsingError is raised (see raiseError).
+ *
+ * @tparam T The type to read the value as.
+ * @param value The value stored.
+ * @return A copy of the value stored.
+ */
+template <class T>
+std::remove_cvref_t<T> valueCast(const std::any &value) {
+  using Type = std::remove_cvref_t<T>;
+  if constexpr (std::is_same_v<Type, std::vector<std::string>>) {
+    if (const auto *list = std::any_cast<StringList>(&value)) {
+      return list->toVector();
+    }
+  } else if constexpr (std::is_same_v<Type, StringList>) {
+    if (const auto *strings = std::any_cast<std::vector<std::string>>(&value)) {
+      return StringList(*strings);
+    }
+  } else if constexpr (std::is_same_v<Type, std::string>) {
+    if (const auto *interned = std::any_cast<InternedString>(&value)) {
+      return std::string(interned->view());
+    }
+  } else if constexpr (std::is_same_v<Type, std::string_view>) {
+    if (const auto *interned = std::any_cast<InternedString>(&value)) {
+      return interned->view();
+    }
+    if (const auto *string = std::any_cast<std::string>(&value)) {
+      return *string;
+    }
+  }
+  const auto *typed_value = std::any_cast<Type>(&value);
+  if (typed_value == nullptr) {
+    raiseError(
+      "The value is not of the type requested", ErrorCode::kBadValueType
+    );
+  }
+  return *typed_value;
+}
+
+/**
+ * @brief Reads the number written in a text, as the toInt, toDouble and
+ * toFloat transformations do. The whole text must be the number, optionally
+ * preceded by a '+'.
+ *
+ * @tparam T The arithmetic type of the number.
+ * @param text The text to read.
+ * @return The number read, or an error with ErrorCode::kBadValueType if the
+ * text is not a number.
+ */
+template <class T>
+Result<T> numberCast(std::string_view text) {
+  if (text.starts_with('+') && !text.starts_with("+-")) text.remove_prefix(1);
+  T number {};
+  const auto *end = text.data() + text.size();
+  const auto [last, error] = std::from_chars(text.data(), end, number);
+  if (error != std::errc() || last != end || text.empty()) {
+    return std::unexpected(ParsingError(
+      "The value is not a valid number", ErrorCode::kBadValueType
+    ));
+  }
+  return number;
+}
+
+}  // namespace input_parser
+
+#endif  // _INPUT_VALUE_CAST_HPP_
\ No newline at end of file
@@ -0,0 +1,87 @@
+/**
+ * @file cmdline.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the functions that read the
+ * command line of a running process.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <input_parser/config.hpp>
+#include <input_parser/cmdline.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+// The size of the first buffer, enough for most command lines
+constexpr std::size_t kCmdlineReadSize = 4096;
+
+/** @brief Reads a whole file of /proc into the buffer provided */
+INPUT_PARSER_INLINE Result<std::string_view> readProcFile(
+  const char *path, std::string &buffer
+) {
+#ifdef __linux__
+  const int descriptor = open(path, O_RDONLY | O_CLOEXEC);
+  if (descriptor >= 0) {
+    if (buffer.size() < kCmdlineReadSize) buffer.resize(kCmdlineReadSize);
+    buffer.resize(buffer.capacity());
+    std::size_t length = 0;
+    while (true) {
+      const auto bytes =
+        read(descriptor, buffer.data() + length, buffer.size() - length);
+      if (bytes < 0 && errno == EINTR) continue;
+      if (bytes < 0) break;
+      length += static_cast<std::size_t>(bytes);
+      // The kernel fills the whole buffer unless the file ended, so a short
+      // read saves the extra call that would return nothing
+      if (length < buffer.size()) {
+        close(descriptor);
+        return std::string_view(buffer.data(), length);
+      }
+      buffer.resize(buffer.size() * 2);
+    }
+    close(descriptor);
+  }
+#endif
+  return std::unexpected(ParsingError(
+    "The command line of the process could not be read!",
+    ErrorCode::kInvalidArguments
+  ));
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE Result<std::string_view> readCmdline(std::string &buffer) {
+  return detail::readProcFile("/proc/self/cmdline", buffer);
+}
+
+INPUT_PARSER_INLINE Result<std::string_view> readCmdline(
+  const int pid, std::string &buffer
+) {
+  std::array<char, 32> path {};
+  constexpr std::string_view kPrefix = "/proc/";
+  constexpr std::string_view kSuffix = "/cmdline";
+  auto *end = std::ranges::copy(kPrefix, path.begin()).out;
+  end = std::to_chars(end, path.end() - kSuffix.size() - 1, pid).ptr;
+  std::ranges::copy(kSuffix, end);
+  return detail::readProcFile(path.data(), buffer);
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,40 @@
+/**
+ * @file constraint_cache.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the cache of results of the
+ * pure constraints.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include <input_parser/config.hpp>
+#include <input_parser/constraint_cache.hpp>
+
+namespace input_parser {
+
+INPUT_PARSER_INLINE ConstraintCache::ConstraintCache(
+  const std::size_t capacity
+) : capacity_ {std::max<std::size_t>(capacity, 1)} {
+  slots_ = std::make_unique<Slot[]>(capacity_);
+  locks_ = std::make_unique<std::mutex[]>(kLocks);
+}
+
+INPUT_PARSER_INLINE void ConstraintCache::clear() {
+  for (std::size_t index = 0; index < capacity_; ++index) {
+    const std::scoped_lock lock(locks_[index % kLocks]);
+    slots_[index] = Slot();
+  }
+  hits_.store(0, std::memory_order_relaxed);
+  misses_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace input_parser
\ No newline at end of file
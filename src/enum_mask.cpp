@@ -0,0 +1,98 @@
+/**
+ * @file enum_mask.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the perfect hash table of the
+ * names of the elements of an enum.
+ *
+ */
+
+#include <algorithm>
+#include <any>
+#include <bit>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <input_parser/config.hpp>
+#include <input_parser/enum_mask.hpp>
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/string_list.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+// The seeds tried for every size of the table before making it bigger
+constexpr std::uint32_t kSeedsPerSize = 64;
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE EnumNames::EnumNames(
+  std::vector<std::pair<std::string, std::size_t>> elements
+) : elements_ {std::move(elements)} {
+  for (std::size_t index = 0; index < elements_.size(); ++index) {
+    if (elements_[index].second >= std::numeric_limits<Bits>::digits) {
+      raiseError(
+        "The element does not fit in a mask", ErrorCode::kBadValueType
+      );
+    }
+    for (std::size_t other = 0; other < index; ++other) {
+      if (elements_[other].first == elements_[index].first) {
+        raiseError("Element already exists!", ErrorCode::kDuplicateOption);
+      }
+    }
+  }
+  // Twice as many slots as names leaves most seeds without collisions
+  auto size = std::bit_ceil(std::max<std::size_t>(2, elements_.size() * 2));
+  while (true) {
+    for (seed_ = 0; seed_ < detail::kSeedsPerSize; ++seed_) {
+      slots_.assign(size, kEmptySlot);
+      const bool placed = std::ranges::all_of(
+        std::views::iota(std::size_t {0}, elements_.size()),
+        [this](const std::size_t index) {
+          auto &slot =
+            slots_[hash(elements_[index].first, seed_) & (slots_.size() - 1)];
+          if (slot != kEmptySlot) return false;
+          slot = static_cast<std::uint32_t>(index);
+          return true;
+        }
+      );
+      if (placed) return;
+    }
+    size *= 2;
+  }
+}
+
+INPUT_PARSER_INLINE EnumNames::Decoding EnumNames::decode(
+  const std::any &values, const char separator
+) const {
+  Decoding decoding;
+  const auto decode_all = [&](const auto &strings) {
+    for (std::string_view value : strings) {
+      while (true) {
+        const auto end = std::min(value.find(separator), value.size());
+        const auto bit = find(value.substr(0, end));
+        const auto mask = bit ? Bits {1} << *bit : 0;
+        if (!bit || (decoding.bits & mask) != 0) decoding.valid = false;
+        decoding.bits |= mask;
+        if (end == value.size()) break;
+        value.remove_prefix(end + 1);
+      }
+    }
+  };
+  if (const auto *list = std::any_cast<StringList>(&values)) {
+    decode_all(*list);
+  } else {
+    decode_all(std::any_cast<const std::vector<std::string> &>(values));
+  }
+  return decoding;
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,84 @@
+/**
+ * @file flag_set.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the packed set of flags.
+ *
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+#include <input_parser/config.hpp>
+#include <input_parser/flag_set.hpp>
+
+namespace input_parser {
+
+INPUT_PARSER_INLINE FlagSet::FlagSet(const std::size_t size) {
+  resize(size);
+}
+
+INPUT_PARSER_INLINE void FlagSet::resize(const std::size_t size) {
+  words_.resize((size + kWordBits - 1) / kWordBits);
+  // Clears the bits that were left out of the set
+  if (size < size_ && size % kWordBits != 0) {
+    words_.back() &= (Word {1} << (size % kWordBits)) - 1;
+  }
+  size_ = size;
+}
+
+INPUT_PARSER_INLINE std::size_t FlagSet::count() const {
+  std::size_t amount = 0;
+  for (const auto word : words_) {
+    amount += static_cast<std::size_t>(std::popcount(word));
+  }
+  return amount;
+}
+
+INPUT_PARSER_INLINE bool FlagSet::all(const FlagSet &group) const {
+  const auto common = std::min(words_.size(), group.words_.size());
+  for (std::size_t index = 0; index < common; ++index) {
+    if ((words_[index] & group.words_[index]) != group.words_[index]) {
+      return false;
+    }
+  }
+  return std::all_of(
+    group.words_.begin() + static_cast<std::ptrdiff_t>(common),
+    group.words_.end(), [](const Word word) { return word == 0; }
+  );
+}
+
+INPUT_PARSER_INLINE bool FlagSet::any(const FlagSet &group) const {
+  const auto common = std::min(words_.size(), group.words_.size());
+  for (std::size_t index = 0; index < common; ++index) {
+    if ((words_[index] & group.words_[index]) != 0) return true;
+  }
+  return false;
+}
+
+INPUT_PARSER_INLINE bool FlagSet::none() const {
+  return std::all_of(words_.begin(), words_.end(), [](const Word word) {
+    return word == 0;
+  });
+}
+
+INPUT_PARSER_INLINE FlagSet &FlagSet::operator&=(const FlagSet &other) {
+  for (std::size_t index = 0; index < words_.size(); ++index) {
+    words_[index] &= index < other.words_.size() ? other.words_[index] : 0;
+  }
+  return *this;
+}
+
+INPUT_PARSER_INLINE FlagSet &FlagSet::operator|=(const FlagSet &other) {
+  if (other.size_ > size_) resize(other.size_);
+  for (std::size_t index = 0; index < other.words_.size(); ++index) {
+    words_[index] |= other.words_[index];
+  }
+  return *this;
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,541 @@
+/**
+ * @file glob.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the functions that expand
+ * glob patterns.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<dirent.h>) && __has_include(<unistd.h>)
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define INPUT_PARSER_HAS_POSIX_DIRECTORIES
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#endif
+
+#include <input_parser/config.hpp>
+#include <input_parser/glob.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+/**
+ * @brief Gets the position of the ']' that closes the bracket expression
+ * opened at the position provided. A ']' right after the '[' (or after the
+ * '!' or '^' that negates it) is one of the characters of the bracket.
+ *
+ * @return The position of the ']', or npos if the bracket is not closed.
+ */
+INPUT_PARSER_INLINE std::size_t bracketEnd(
+  const std::string_view pattern, const std::size_t open
+) {
+  auto index = open + 1;
+  if (index < pattern.size() &&
+      (pattern[index] == '!' || pattern[index] == '^')) {
+    ++index;
+  }
+  if (index < pattern.size() && pattern[index] == ']') ++index;
+  while (index < pattern.size() && pattern[index] != ']') ++index;
+  return index < pattern.size() ? index : std::string_view::npos;
+}
+
+/** @brief Checks if a character is one of a bracket (without the brackets) */
+INPUT_PARSER_INLINE bool matchBracket(
+  std::string_view bracket, const char character
+) {
+  const bool negated =
+    !bracket.empty() && (bracket.front() == '!' || bracket.front() == '^');
+  if (negated) bracket.remove_prefix(1);
+  const auto value = static_cast<unsigned char>(character);
+  bool found = false;
+  for (std::size_t index = 0; index < bracket.size(); ++index) {
+    if (index + 2 < bracket.size() && bracket[index + 1] == '-') {
+      const auto first = static_cast<unsigned char>(bracket[index]);
+      const auto last = static_cast<unsigned char>(bracket[index + 2]);
+      found = found || (first <= value && value <= last);
+      index += 2;
+    } else {
+      found = found || bracket[index] == character;
+    }
+  }
+  return found != negated;
+}
+
+/**
+ * @brief Matches a character against the element of a pattern at the
+ * position provided, which is not a '*'.
+ *
+ * @return The characters of the pattern used, or 0 if it does not match.
+ */
+INPUT_PARSER_INLINE std::size_t matchGlobElement(
+  const std::string_view pattern, const std::size_t index, const char character
+) {
+  switch (pattern[index]) {
+    case '?':
+      return 1;
+    case '[':
+      if (const auto end = bracketEnd(pattern, index);
+          end != std::string_view::npos) {
+        const auto bracket = pattern.substr(index + 1, end - index - 1);
+        return matchBracket(bracket, character) ? end - index + 1 : 0;
+      }
+      break;
+    case '\\':
+      if (index + 1 < pattern.size()) {
+        return pattern[index + 1] == character ? 2 : 0;
+      }
+      break;
+    default:
+      break;
+  }
+  return pattern[index] == character ? 1 : 0;
+}
+
+/** @brief Removes the backslashes of a pattern without wildcards */
+INPUT_PARSER_INLINE std::string unescapeGlob(const std::string_view pattern) {
+  std::string literal;
+  literal.reserve(pattern.size());
+  for (std::size_t index = 0; index < pattern.size(); ++index) {
+    if (pattern[index] == '\\' && index + 1 < pattern.size()) ++index;
+    literal += pattern[index];
+  }
+  return literal;
+}
+
+#ifdef INPUT_PARSER_HAS_POSIX_DIRECTORIES
+
+// The most threads listing directories at the same time
+constexpr unsigned int kMaxGlobWorkers = 8;
+// The bytes requested on every listing of a directory
+constexpr std::size_t kDirectoryReadSize = std::size_t {32} << 10;
+
+/** @brief A component of a glob pattern, the text between two slashes */
+struct GlobComponent {
+  // The pattern (or the name itself, without backslashes, if it is literal)
+  std::string pattern;
+  // Whether the component has no wildcards
+  bool literal;
+  // Whether the component is "**"
+  bool recursive;
+};
+
+/** @brief A directory waiting to be listed */
+struct GlobTask {
+  // The path of the directory, ended by a slash (empty for the current one)
+  std::string directory;
+  // The component matched against the entries of the directory
+  std::size_t component;
+};
+
+/** @brief An entry of a directory listed */
+struct GlobEntry {
+  // The position of the name in the names of the listing
+  std::size_t offset;
+  // The length of the name
+  std::size_t size;
+  // The type of the entry (DT_DIR, DT_REG, DT_LNK, DT_UNKNOWN...)
+  unsigned char type;
+};
+
+/** @brief What a thread keeps between the directories it lists */
+struct GlobWorker {
+  // Where the records of the directories are read
+  std::vector<char> buffer = std::vector<char>(kDirectoryReadSize);
+  // The names of the entries of the directory listed
+  std::string names;
+  // The entries of the directory listed
+  std::vector<GlobEntry> entries;
+  // The directories found that have to be listed
+  std::vector<GlobTask> tasks;
+  // The paths matched
+  StringList matches;
+};
+
+/**
+ * @brief Reads every entry of a directory, except "." and "..". On Linux
+ * the records are read with getdents64, many at once.
+ */
+INPUT_PARSER_INLINE void listGlobDirectory(
+  const int descriptor, GlobWorker &worker
+) {
+  worker.names.clear();
+  worker.entries.clear();
+  const auto add = [&](const std::string_view name, const unsigned char type) {
+    if (name == "." || name == "..") return;
+    worker.entries.push_back({worker.names.size(), name.size(), type});
+    worker.names.append(name);
+  };
+#ifdef __linux__
+  // The layout of the records: inode (8 bytes), offset (8), length (2),
+  // type (1) and the name ended by a NUL character
+  constexpr std::size_t kLengthOffset = 16;
+  constexpr std::size_t kTypeOffset = 18;
+  constexpr std::size_t kNameOffset = 19;
+  while (true) {
+    const auto bytes = syscall(
+      SYS_getdents64, descriptor, worker.buffer.data(), worker.buffer.size()
+    );
+    if (bytes <= 0) return;
+    for (long offset = 0; offset < bytes;) {
+      const auto *record = worker.buffer.data() + offset;
+      std::uint16_t length = 0;
+      std::memcpy(&length, record + kLengthOffset, sizeof(length));
+      add(
+        std::string_view(record + kNameOffset),
+        static_cast<unsigned char>(record[kTypeOffset])
+      );
+      offset += length;
+    }
+  }
+#else
+  const auto copy = dup(descriptor);
+  if (copy < 0) return;
+  DIR *directory = fdopendir(copy);
+  if (directory == nullptr) {
+    close(copy);
+    return;
+  }
+  while (const auto *entry = readdir(directory)) {
+    add(entry->d_name, entry->d_type);
+  }
+  closedir(directory);
+#endif
+}
+
+/**
+ * @brief Checks if an entry is a directory, asking the file system when the
+ * listing does not tell.
+ *
+ * @param follow Whether a symbolic link to a directory counts as one.
+ */
+INPUT_PARSER_INLINE bool isGlobDirectory(
+  const int descriptor, const char *name, const unsigned char type,
+  const bool follow
+) {
+  if (type == DT_DIR) return true;
+  if (type != DT_UNKNOWN && (type != DT_LNK || !follow)) return false;
+  struct stat status {};
+  const int flags = follow ? 0 : AT_SYMLINK_NOFOLLOW;
+  return fstatat(descriptor, name, &status, flags) == 0 &&
+         S_ISDIR(status.st_mode);
+}
+
+/**
+ * @brief The expansion of a single pattern. The directories are listed by a
+ * pool of threads that starts with the calling one and grows (up to
+ * kMaxGlobWorkers) while there are more directories waiting than idle
+ * threads.
+ */
+class GlobWalk {
+ public:
+  GlobWalk(
+    std::vector<GlobComponent> components, const ParseLimits &limits,
+    const unsigned int workers
+  ) : components_ {std::move(components)},
+      limits_ {limits},
+      workers_ {
+        workers != 0
+          ? workers
+          : std::clamp(std::thread::hardware_concurrency(), 1U, kMaxGlobWorkers)
+      } {}
+
+  /**
+   * @brief Lists the directories from the root provided.
+   *
+   * @return Every path matched (in no particular order), or the error of the
+   * limit exceeded.
+   */
+  Result<StringList> run(std::string root) {
+    tasks_.push_back({std::move(root), 0});
+    work();
+    // The calling thread leaves as soon as an error is found, but the rest
+    // can still be listing (and starting threads) until they are done
+    {
+      std::unique_lock lock(mutex_);
+      wake_.wait(lock, [&] { return busy_ == 0; });
+    }
+    for (auto &thread : threads_) thread.join();
+    if (error_) return std::unexpected(*error_);
+    return std::move(found_);
+  }
+
+ private:
+  // The components of the pattern, after the root
+  std::vector<GlobComponent> components_;
+  // The limits on the paths matched
+  const ParseLimits &limits_;
+  // The most threads that can list directories
+  unsigned int workers_;
+  // Guards everything below
+  std::mutex mutex_;
+  // Wakes the threads waiting for directories
+  std::condition_variable wake_;
+  // The directories waiting to be listed
+  std::vector<GlobTask> tasks_;
+  // The threads started besides the calling one
+  std::vector<std::thread> threads_;
+  // The amount of threads listing a directory
+  unsigned int busy_ = 0;
+  // The amount of threads waiting for a directory
+  unsigned int idle_ = 0;
+  // The paths matched by every thread
+  StringList found_;
+  // The error that stopped the expansion (if any)
+  std::optional<ParsingError> error_;
+
+  /** @brief Lists directories until there are none left or an error */
+  void work() {
+    GlobWorker worker;
+    std::unique_lock lock(mutex_);
+    while (true) {
+      ++idle_;
+      wake_.wait(lock, [&] {
+        return error_ || !tasks_.empty() || busy_ == 0;
+      });
+      --idle_;
+      if (error_ || tasks_.empty()) break;
+      auto task = std::move(tasks_.back());
+      tasks_.pop_back();
+      ++busy_;
+      lock.unlock();
+      visit(std::move(task), worker);
+      lock.lock();
+      --busy_;
+      merge(worker);
+      if (!error_ && tasks_.size() > idle_ &&
+          threads_.size() + 1 < workers_) {
+        threads_.emplace_back([this] { work(); });
+      }
+      if (!tasks_.empty() || busy_ == 0 || error_) wake_.notify_all();
+    }
+    wake_.notify_all();
+  }
+
+  /**
+   * @brief Adds the directories and paths found by a thread (locked). Once
+   * there is an error, nothing is added and no directory is left to list.
+   */
+  void merge(GlobWorker &worker) {
+    if (!error_) {
+      for (auto &task : worker.tasks) tasks_.push_back(std::move(task));
+      for (const auto path : worker.matches) {
+        if (found_.size() == limits_.max_compound_values) {
+          error_ = ParsingError(
+            "Too many values matched by the glob pattern!",
+            ErrorCode::kLimitExceeded
+          );
+          tasks_.clear();
+          break;
+        }
+        found_.push_back(path);
+      }
+    }
+    worker.tasks.clear();
+    worker.matches = StringList();
+  }
+
+  /** @brief Matches the entries of a directory against its component */
+  void visit(GlobTask task, GlobWorker &worker) const {
+    auto &[directory, component] = task;
+    // The literal components are names to follow, not to search
+    while (component + 1 < components_.size() &&
+           components_[component].literal) {
+      directory += components_[component].pattern;
+      directory += '/';
+      ++component;
+    }
+    if (component + 1 == components_.size() &&
+        components_[component].literal) {
+      const auto path = directory + components_[component].pattern;
+      struct stat status {};
+      if (lstat(path.c_str(), &status) == 0) worker.matches.push_back(path);
+      return;
+    }
+    const int descriptor = open(
+      directory.empty() ? "." : directory.c_str(),
+      O_RDONLY | O_DIRECTORY | O_CLOEXEC
+    );
+    // The directories that can not be read have no matches
+    if (descriptor < 0) return;
+    listGlobDirectory(descriptor, worker);
+    match(descriptor, directory, component, worker);
+    close(descriptor);
+  }
+
+  /** @brief Matches the entries listed against a component */
+  void match(
+    const int descriptor, const std::string &directory,
+    const std::size_t component, GlobWorker &worker
+  ) const {
+    const auto &part = components_[component];
+    const bool last = component + 1 == components_.size();
+    std::string path;
+    for (const auto &entry : worker.entries) {
+      const auto name = std::string_view(worker.names).substr(
+        entry.offset, entry.size
+      );
+      if (name.front() == '.' && !part.pattern.starts_with('.')) continue;
+      const bool matched = part.recursive ||
+                           (part.literal ? name == part.pattern
+                                         : matchGlob(part.pattern, name));
+      if (!matched) continue;
+      path.assign(directory).append(name);
+      if (last) worker.matches.push_back(path);
+      if (!part.recursive && last) continue;
+      // "**" goes down every directory, but never through a symbolic link
+      if (isGlobDirectory(
+            descriptor, path.c_str() + directory.size(), entry.type,
+            !part.recursive
+          )) {
+        worker.tasks.push_back(
+          {path + '/', part.recursive ? component : component + 1}
+        );
+      }
+    }
+    // "**" also stands for no directory at all
+    if (part.recursive && !last) {
+      match(descriptor, directory, component + 1, worker);
+    }
+  }
+};
+
+#endif
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE bool isGlobPattern(const std::string_view value) {
+  for (std::size_t index = 0; index < value.size(); ++index) {
+    switch (value[index]) {
+      case '\\':
+        ++index;
+        break;
+      case '*':
+      case '?':
+        return true;
+      case '[':
+        if (detail::bracketEnd(value, index) != std::string_view::npos) {
+          return true;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
+INPUT_PARSER_INLINE bool matchGlob(
+  const std::string_view pattern, const std::string_view name
+) {
+  std::size_t index = 0;
+  std::size_t position = 0;
+  // Where the last '*' seen resumes when a later element does not match
+  auto star = std::string_view::npos;
+  std::size_t star_position = 0;
+  while (position < name.size()) {
+    if (index < pattern.size() && pattern[index] == '*') {
+      star = ++index;
+      star_position = position;
+      continue;
+    }
+    if (index < pattern.size()) {
+      if (const auto used = detail::matchGlobElement(
+            pattern, index, name[position]
+          )) {
+        index += used;
+        ++position;
+        continue;
+      }
+    }
+    if (star == std::string_view::npos) return false;
+    index = star;
+    position = ++star_position;
+  }
+  while (index < pattern.size() && pattern[index] == '*') ++index;
+  return index == pattern.size();
+}
+
+INPUT_PARSER_INLINE Result<> expandGlob(
+  const std::string_view pattern, StringList &matches,
+  const ParseLimits &limits, const unsigned int threads
+) {
+#ifdef INPUT_PARSER_HAS_POSIX_DIRECTORIES
+  std::vector<detail::GlobComponent> components;
+  for (std::size_t start = 0; start <= pattern.size();) {
+    const auto end = std::min(pattern.find('/', start), pattern.size());
+    const auto text = pattern.substr(start, end - start);
+    start = end + 1;
+    // Repeated slashes are a single one, but a trailing slash keeps only the
+    // directories
+    if (text.empty() && end != pattern.size()) continue;
+    if (text.empty() && components.empty()) continue;
+    const bool recursive = text == "**";
+    if (recursive && !components.empty() && components.back().recursive) {
+      continue;
+    }
+    const bool literal = !isGlobPattern(text);
+    components.push_back(
+      {literal ? detail::unescapeGlob(text) : std::string(text), literal,
+       recursive}
+    );
+  }
+  std::vector<std::string_view> paths;
+  StringList found;
+  if (!components.empty()) {
+    auto walk = detail::GlobWalk(std::move(components), limits, threads);
+    auto result = walk.run(pattern.starts_with('/') ? "/" : "");
+    if (!result) return std::unexpected(result.error());
+    found = std::move(*result);
+    paths.assign(found.begin(), found.end());
+    std::ranges::sort(paths);
+    const auto repeated = std::ranges::unique(paths);
+    paths.erase(repeated.begin(), repeated.end());
+  }
+  if (paths.empty()) paths.push_back(pattern);
+  for (const auto path : paths) {
+    if (path.size() > limits.max_argument_length) {
+      return std::unexpected(
+        ParsingError("An argument is too long!", ErrorCode::kLimitExceeded)
+      );
+    }
+    if (matches.size() == limits.max_compound_values) {
+      return std::unexpected(ParsingError(
+        "Too many values matched by the glob pattern!",
+        ErrorCode::kLimitExceeded
+      ));
+    }
+    matches.push_back(path);
+  }
+  return {};
+#else
+  return std::unexpected(ParsingError(
+    "The glob patterns can not be expanded on this platform!",
+    ErrorCode::kInvalidArguments
+  ));
+#endif
+}
+
+}  // namespace input_parser
\ No newline at end of file
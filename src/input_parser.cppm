@@ -0,0 +1,121 @@
+/**
+ * @file input_parser.cppm
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the interface of the input_parser module. It exports
+ * the same entities as the headers, so `import input_parser;` can replace
+ * `#include <input_parser/parser.hpp>`.
+ *
+ */
+
+module;
+
+#include <input_parser/chain.hpp>
+#include <input_parser/cmdline.hpp>
+#include <input_parser/constraint.hpp>
+#include <input_parser/constraint_cache.hpp>
+#include <input_parser/enum_mask.hpp>
+#include <input_parser/flag_set.hpp>
+#include <input_parser/glob.hpp>
+#include <input_parser/json_reader.hpp>
+#include <input_parser/local_concepts.hpp>
+#include <input_parser/memory_usage.hpp>
+#include <input_parser/name_filter.hpp>
+#include <input_parser/option/base_option.hpp>
+#include <input_parser/option/compound_option.hpp>
+#include <input_parser/option/flag_option.hpp>
+#include <input_parser/option/option_family.hpp>
+#include <input_parser/option/single_option.hpp>
+#include <input_parser/parse_limits.hpp>
+#include <input_parser/parser.hpp>
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/pattern_matcher.hpp>
+#include <input_parser/percent_decoding.hpp>
+#include <input_parser/record_stream.hpp>
+#include <input_parser/schema.hpp>
+#include <input_parser/string_hash.hpp>
+#include <input_parser/string_interner.hpp>
+#include <input_parser/string_list.hpp>
+#include <input_parser/utf8.hpp>
+#include <input_parser/value_cast.hpp>
+
+export module input_parser;
+
+export namespace input_parser {
+
+// --------------------------------- Parser -------------------------------- //
+
+using input_parser::Option;
+using input_parser::ParseLimits;
+using input_parser::Parser;
+
+// --------------------------------- Schema -------------------------------- //
+
+using input_parser::isValidOptionName;
+using input_parser::OptionKind;
+using input_parser::Schema;
+using input_parser::SchemaName;
+using input_parser::SchemaOption;
+
+// -------------------------------- Options -------------------------------- //
+
+using input_parser::BaseOption;
+using input_parser::CacheableValue;
+using input_parser::chain;
+using input_parser::Chain;
+using input_parser::CompoundOption;
+using input_parser::Constraint;
+using input_parser::ConstraintCache;
+using input_parser::FlagOption;
+using input_parser::Hashable;
+using input_parser::OptionFamily;
+using input_parser::PatternMatch;
+using input_parser::PatternMatcher;
+using input_parser::SingleOption;
+using input_parser::StringKind;
+
+// --------------------------------- Errors -------------------------------- //
+
+using input_parser::ErrorCode;
+using input_parser::ErrorHandler;
+using input_parser::ParsingError;
+using input_parser::raiseError;
+using input_parser::Result;
+using input_parser::setErrorHandler;
+
+// --------------------------------- Values -------------------------------- //
+
+using input_parser::EnumMask;
+using input_parser::EnumNames;
+using input_parser::expandGlob;
+using input_parser::findInvalidUtf8;
+using input_parser::findInvalidUtf8Value;
+using input_parser::FlagSet;
+using input_parser::InternedString;
+using input_parser::isGlobPattern;
+using input_parser::isValidUtf8;
+using input_parser::JsonKind;
+using input_parser::JsonReader;
+using input_parser::matchGlob;
+using input_parser::NameFilter;
+using input_parser::numberCast;
+using input_parser::percentDecode;
+using input_parser::readCmdline;
+using input_parser::readRecords;
+using input_parser::streamDescriptor;
+using input_parser::StringHash;
+using input_parser::StringInterner;
+using input_parser::StringList;
+using input_parser::Utf8Error;
+using input_parser::valueCast;
+
+// ------------------------------ Memory usage ----------------------------- //
+
+using input_parser::heapBytes;
+using input_parser::MemoryUsage;
+using input_parser::OptionMemoryUsage;
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,369 @@
+/**
+ * @file json_reader.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the on-demand JSON reader.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <input_parser/config.hpp>
+#include <input_parser/json_reader.hpp>
+#include <input_parser/parsing_error.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+/** @brief Checks if a character is a decimal digit */
+INPUT_PARSER_INLINE bool isDigit(const char character) {
+  return character >= '0' && character <= '9';
+}
+
+/**
+ * @brief Reads four hexadecimal digits.
+ *
+ * @param digits The text that starts with the digits.
+ * @param value Where the value read is stored (0 if malformed).
+ * @return Whether the four digits were read or not.
+ */
+INPUT_PARSER_INLINE bool readHex4(
+  const std::string_view digits, std::uint32_t &value
+) {
+  value = 0;
+  if (digits.size() < 4) return false;
+  for (const char digit : digits.substr(0, 4)) {
+    value <<= 4;
+    if (isDigit(digit)) value |= static_cast<std::uint32_t>(digit - '0');
+    else if (digit >= 'a' && digit <= 'f') value |= digit - 'a' + 10U;
+    else if (digit >= 'A' && digit <= 'F') value |= digit - 'A' + 10U;
+    else return false;
+  }
+  return true;
+}
+
+/** @brief Appends a code point to a string, encoded as UTF-8 */
+INPUT_PARSER_INLINE void appendUtf8(
+  std::string &text, const std::uint32_t code_point
+) {
+  if (code_point < 0x80) {
+    text.push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    text.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    text.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    text.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    text.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    text.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else {
+    text.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    text.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    text.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    text.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE Result<JsonKind> JsonReader::peek() {
+  skipSpaces();
+  if (position_ == text_.size()) return malformed("Unexpected end");
+  switch (text_[position_]) {
+    case '{':
+      return JsonKind::kObject;
+    case '[':
+      return JsonKind::kArray;
+    case '"':
+      return JsonKind::kString;
+    case 't':
+    case 'f':
+      return JsonKind::kBoolean;
+    case 'n':
+      return JsonKind::kNull;
+    default:
+      if (text_[position_] == '-' || detail::isDigit(text_[position_])) {
+        return JsonKind::kNumber;
+      }
+      return malformed("Unexpected character");
+  }
+}
+
+INPUT_PARSER_INLINE Result<> JsonReader::enter(const char open) {
+  return expect(open);
+}
+
+INPUT_PARSER_INLINE Result<std::optional<std::string_view>>
+JsonReader::nextKey(const bool first, std::string &buffer) {
+  skipSpaces();
+  if (position_ < text_.size() && text_[position_] == '}') {
+    ++position_;
+    return std::nullopt;
+  }
+  if (!first) {
+    if (auto result = expect(','); !result) {
+      return std::unexpected(result.error());
+    }
+    skipSpaces();
+  }
+  if (position_ == text_.size() || text_[position_] != '"') {
+    return malformed("Expected a key");
+  }
+  const auto key = readString(buffer);
+  if (!key) return std::unexpected(key.error());
+  if (auto result = expect(':'); !result) {
+    return std::unexpected(result.error());
+  }
+  return *key;
+}
+
+INPUT_PARSER_INLINE Result<bool> JsonReader::nextElement(const bool first) {
+  skipSpaces();
+  if (position_ < text_.size() && text_[position_] == ']') {
+    ++position_;
+    return false;
+  }
+  if (!first) {
+    if (auto result = expect(','); !result) {
+      return std::unexpected(result.error());
+    }
+  }
+  return true;
+}
+
+INPUT_PARSER_INLINE Result<std::string_view> JsonReader::readScalar(
+  std::string &buffer
+) {
+  const auto kind = peek();
+  if (!kind) return std::unexpected(kind.error());
+  switch (*kind) {
+    case JsonKind::kString:
+      return readString(buffer);
+    case JsonKind::kNumber:
+      return readNumber();
+    case JsonKind::kBoolean:
+      return readLiteral(text_[position_] == 't' ? "true" : "false");
+    default:
+      return malformed("Expected a string, a number or a boolean");
+  }
+}
+
+INPUT_PARSER_INLINE Result<> JsonReader::skip() {
+  const auto kind = peek();
+  if (!kind) return std::unexpected(kind.error());
+  if (*kind == JsonKind::kNull) {
+    if (auto result = readLiteral("null"); !result) {
+      return std::unexpected(result.error());
+    }
+    return {};
+  }
+  if (*kind != JsonKind::kObject && *kind != JsonKind::kArray) {
+    std::string buffer;
+    if (*kind == JsonKind::kString) {
+      if (auto result = skipString(); !result) {
+        return std::unexpected(result.error());
+      }
+      return {};
+    }
+    if (auto result = readScalar(buffer); !result) {
+      return std::unexpected(result.error());
+    }
+    return {};
+  }
+  // Only the strings and the brackets matter to find the end, but every
+  // bracket must be closed by its pair
+  std::string closers;
+  while (position_ < text_.size()) {
+    const char character = text_[position_];
+    if (character == '"') {
+      if (auto result = skipString(); !result) {
+        return std::unexpected(result.error());
+      }
+      continue;
+    }
+    ++position_;
+    if (character == '{') closers.push_back('}');
+    if (character == '[') closers.push_back(']');
+    if (character != '}' && character != ']') continue;
+    if (closers.back() != character) return malformed("Mismatched bracket");
+    closers.pop_back();
+    if (closers.empty()) return {};
+  }
+  return malformed("Unexpected end");
+}
+
+INPUT_PARSER_INLINE Result<> JsonReader::finish() {
+  skipSpaces();
+  if (position_ != text_.size()) return malformed("Unexpected text");
+  return {};
+}
+
+// ---------------------------- Private methods ---------------------------- //
+
+INPUT_PARSER_INLINE void JsonReader::skipSpaces() {
+  while (position_ < text_.size() &&
+         (text_[position_] == ' ' || text_[position_] == '\n' ||
+          text_[position_] == '\r' || text_[position_] == '\t')) {
+    ++position_;
+  }
+}
+
+INPUT_PARSER_INLINE Result<> JsonReader::expect(const char character) {
+  skipSpaces();
+  if (position_ == text_.size() || text_[position_] != character) {
+    return malformed("Unexpected character");
+  }
+  ++position_;
+  return {};
+}
+
+INPUT_PARSER_INLINE Result<std::string_view> JsonReader::readString(
+  std::string &buffer
+) {
+  const auto start = position_ + 1;
+  const auto escaped = skipString();
+  if (!escaped) return std::unexpected(escaped.error());
+  const auto content = text_.substr(start, position_ - 1 - start);
+  if (!*escaped) {
+    if (std::ranges::any_of(content, [](const char character) {
+          return static_cast<unsigned char>(character) < 0x20;
+        })) {
+      return malformed("Control character inside a string");
+    }
+    return content;
+  }
+  buffer.clear();
+  buffer.reserve(content.size());
+  for (std::size_t index = 0; index < content.size(); ++index) {
+    const char character = content[index];
+    if (static_cast<unsigned char>(character) < 0x20) {
+      return malformed("Control character inside a string");
+    }
+    if (character != '\\') {
+      buffer.push_back(character);
+      continue;
+    }
+    switch (content[++index]) {
+      case '"':
+      case '\\':
+      case '/':
+        buffer.push_back(content[index]);
+        break;
+      case 'b':
+        buffer.push_back('\b');
+        break;
+      case 'f':
+        buffer.push_back('\f');
+        break;
+      case 'n':
+        buffer.push_back('\n');
+        break;
+      case 'r':
+        buffer.push_back('\r');
+        break;
+      case 't':
+        buffer.push_back('\t');
+        break;
+      case 'u': {
+        std::uint32_t code_point = 0;
+        bool valid = detail::readHex4(content.substr(index + 1), code_point);
+        index += 4;
+        if (valid && code_point >= 0xD800 && code_point < 0xDC00) {
+          // A high surrogate must be followed by a low one
+          std::uint32_t low = 0;
+          valid = content.substr(index + 1).starts_with("\\u") &&
+                  detail::readHex4(content.substr(index + 3), low) &&
+                  low >= 0xDC00 && low < 0xE000;
+          code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+          index += 6;
+        } else if (code_point >= 0xDC00 && code_point < 0xE000) {
+          valid = false;
+        }
+        if (!valid) return malformed("Malformed unicode escape");
+        detail::appendUtf8(buffer, code_point);
+        break;
+      }
+      default:
+        return malformed("Malformed escape sequence");
+    }
+  }
+  return buffer;
+}
+
+INPUT_PARSER_INLINE Result<bool> JsonReader::skipString() {
+  const char *const data = text_.data();
+  const auto start = ++position_;
+  while (true) {
+    const auto *quote = static_cast<const char *>(
+      std::memchr(data + position_, '"', text_.size() - position_)
+    );
+    if (quote == nullptr) return malformed("Unterminated string");
+    const auto end = static_cast<std::size_t>(quote - data);
+    // The quote is escaped if an odd amount of backslashes goes before it
+    auto backslashes = end;
+    while (backslashes > start && data[backslashes - 1] == '\\') --backslashes;
+    position_ = end + 1;
+    if ((end - backslashes) % 2 == 0) {
+      return std::memchr(data + start, '\\', end - start) != nullptr;
+    }
+  }
+}
+
+INPUT_PARSER_INLINE Result<std::string_view> JsonReader::readNumber() {
+  const auto start = position_;
+  const auto digits = [this] {
+    const auto first = position_;
+    while (position_ < text_.size() && detail::isDigit(text_[position_])) {
+      ++position_;
+    }
+    return position_ - first;
+  };
+  const auto accept = [this](const std::string_view characters) {
+    if (position_ == text_.size()) return false;
+    if (!characters.contains(text_[position_])) return false;
+    ++position_;
+    return true;
+  };
+  accept("-");
+  const bool leading_zero =
+    position_ < text_.size() && text_[position_] == '0';
+  const auto integer_digits = digits();
+  if (integer_digits == 0 || (leading_zero && integer_digits > 1)) {
+    return malformed("Malformed number");
+  }
+  if (accept(".") && digits() == 0) return malformed("Malformed number");
+  if (accept("eE")) {
+    accept("+-");
+    if (digits() == 0) return malformed("Malformed number");
+  }
+  return text_.substr(start, position_ - start);
+}
+
+INPUT_PARSER_INLINE Result<std::string_view> JsonReader::readLiteral(
+  const std::string_view literal
+) {
+  if (!text_.substr(position_).starts_with(literal)) {
+    return malformed("Unknown literal");
+  }
+  position_ += literal.size();
+  return literal;
+}
+
+INPUT_PARSER_INLINE std::unexpected<ParsingError> JsonReader::malformed(
+  const char *reason
+) const {
+  return std::unexpected(ParsingError(
+    "Malformed JSON at position " + std::to_string(position_) + ": " + reason,
+    ErrorCode::kInvalidArguments
+  ));
+}
+
+}  // namespace input_parser
\ No newline at end of file
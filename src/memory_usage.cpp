@@ -0,0 +1,104 @@
+/**
+ * @file memory_usage.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the helpers used to estimate
+ * the memory footprint of the parser.
+ *
+ */
+
+#include <any>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <input_parser/config.hpp>
+#include <input_parser/memory_usage.hpp>
+#include <input_parser/string_interner.hpp>
+#include <input_parser/string_list.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+/**
+ * @brief Bytes allocated by std::any to hold an object of the type provided.
+ *   Objects not bigger than a pointer are stored inside the std::any itself.
+ */
+template <class T>
+constexpr std::size_t anyPayloadBytes() {
+  return sizeof(T) > sizeof(void *) ? sizeof(T) : 0;
+}
+
+template <class T>
+std::size_t vectorHeapBytes(const std::vector<T> &values) {
+  if constexpr (std::is_same_v<T, bool>) {
+    return (values.capacity() + 7) / 8;
+  } else {
+    auto bytes = values.capacity() * sizeof(T);
+    if constexpr (std::is_same_v<T, std::string>) {
+      for (const auto &value : values) bytes += heapBytes(value);
+    }
+    return bytes;
+  }
+}
+
+/**
+ * @brief Measures the value if it holds one of the types provided.
+ *
+ * @return Whether the value was measured or not.
+ */
+template <class... Ts>
+bool measureAny(const std::any &value, std::size_t &bytes) {
+  return ([&] {
+    const auto *typed_value = std::any_cast<Ts>(&value);
+    if (typed_value == nullptr) return false;
+    bytes = anyPayloadBytes<Ts>();
+    if constexpr (std::is_same_v<Ts, std::string>) {
+      bytes += heapBytes(*typed_value);
+    } else if constexpr (std::is_same_v<Ts, StringList>) {
+      bytes += typed_value->capacityBytes();
+    } else if constexpr (std::is_same_v<Ts, InternedString>) {
+      // The characters belong to the interner, shared by every value
+    } else if constexpr (!std::is_arithmetic_v<Ts>) {
+      bytes += vectorHeapBytes(*typed_value);
+    }
+    return true;
+  }() || ...);
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE std::size_t MemoryUsage::total() const {
+  return std::accumulate(
+    options.begin(), options.end(),
+    options_nodes + options_buckets + names_nodes + names_buckets + flags,
+    [](std::size_t sum, const OptionMemoryUsage &option) {
+      return sum + option.total();
+    }
+  );
+}
+
+INPUT_PARSER_INLINE std::size_t heapBytes(const std::string &str) {
+  static const auto small_capacity = std::string().capacity();
+  return str.capacity() > small_capacity ? str.capacity() + 1 : 0;
+}
+
+INPUT_PARSER_INLINE std::size_t heapBytes(const std::pmr::string &str) {
+  static const auto small_capacity = std::pmr::string().capacity();
+  return str.capacity() > small_capacity ? str.capacity() + 1 : 0;
+}
+
+INPUT_PARSER_INLINE std::size_t heapBytes(const std::any &value) {
+  std::size_t bytes = 0;
+  detail::measureAny<
+    bool, int, long, long long, unsigned, float, double, std::string,
+    StringList, InternedString, std::vector<std::string>, std::vector<bool>,
+    std::vector<int>, std::vector<double>, std::vector<float>>(value, bytes);
+  return bytes;
+}
+
+}  // namespace input_parser
\ No newline at end of file
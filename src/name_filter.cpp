@@ -0,0 +1,30 @@
+/**
+ * @file name_filter.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the prefilter of option names.
+ *
+ */
+
+#include <algorithm>
+#include <string_view>
+
+#include <input_parser/config.hpp>
+#include <input_parser/name_filter.hpp>
+
+namespace input_parser {
+
+INPUT_PARSER_INLINE void NameFilter::add(const std::string_view name) {
+  max_length_ = std::max(max_length_, name.size());
+  set(lengths_, lengthSlot(name.size()));
+  if (name.empty()) return;
+  set(first_characters_, static_cast<unsigned char>(name.front()));
+  const auto key = digest(name);
+  set(bloom_, key % kBloomBits);
+  set(bloom_, (key >> kSecondProbeShift) % kBloomBits);
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -9,55 +9,198 @@
  * parser, that can be a flag, a single value or compound values.
  *
  */
+#include <algorithm>
 #include <any>
+#include <cstddef>
+#include <numeric>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include <input_parser/config.hpp>
 #include <input_parser/option/base_option.hpp>
 #include <input_parser/parsing_error.hpp>
 
 namespace input_parser {
 
-BaseOption &BaseOption::addDefaultValue(const std::any &default_value) {
+INPUT_PARSER_INLINE BaseOption::BaseOption(std::vector<std::string> names) :
+  names_ {std::move(names)},
+  required_ {true},
+  transform_before_check_ {false},
+  adaptive_order_ {false},
+  checks_ {0} {
+  transformation_ = [](const std::any &value) -> std::any { return value; };
+}
+
+INPUT_PARSER_INLINE BaseOption &BaseOption::addDefaultValue(
+  const std::any &default_value
+) {
   default_value_ = default_value;
   return beRequired(false);
 }
 
-BaseOption &BaseOption::addDescription(const std::string &description) {
+INPUT_PARSER_INLINE BaseOption &BaseOption::addDescription(
+  const std::string &description
+) {
   description_ = description;
   return *this;
 }
 
-void BaseOption::setValue(const std::any &value) {
+INPUT_PARSER_INLINE void BaseOption::setValue(const std::any &value) {
+  if (auto result = trySetValue(value); !result) raiseError(result.error());
+}
+
+INPUT_PARSER_INLINE Result<> BaseOption::trySetValue(const std::any &value) {
+  if (transform_before_check_) {
+    auto converted = transform(value);
+    if (!converted) return std::unexpected(converted.error());
+    value_ = std::move(*converted);
+    return checkConstraints(value_);
+  }
+  if (auto result = checkConstraints(value); !result) return result;
+  auto converted = transform(value);
+  if (!converted) return std::unexpected(converted.error());
+  value_ = std::move(*converted);
+  return {};
+}
+
+INPUT_PARSER_INLINE Result<std::any> BaseOption::convertValue(
+  const std::any &value
+) const {
   if (transform_before_check_) {
-    value_ = transformation_(value);
-    checkConstraints(value_);
-  } else {
-    checkConstraints(value);
-    value_ = transformation_(value);
+    auto converted = transform(value);
+    if (!converted) return converted;
+    if (auto result = checkConstraints(*converted); !result) {
+      return std::unexpected(result.error());
+    }
+    return converted;
+  }
+  if (auto result = checkConstraints(value); !result) {
+    return std::unexpected(result.error());
   }
+  return transform(value);
+}
+
+INPUT_PARSER_INLINE Result<std::any> BaseOption::transform(
+  const std::any &value
+) const {
+  auto converted = transformation_(value);
+  if (const auto *error = std::any_cast<ParsingError>(&converted)) {
+    return std::unexpected(*error);
+  }
+  return converted;
+}
+
+INPUT_PARSER_INLINE void BaseOption::internValue(StringInterner &interner) {
+  if (const auto *value = std::any_cast<std::string>(&value_)) {
+    value_ = interner.intern(*value);
+  }
+}
+
+INPUT_PARSER_INLINE void BaseOption::clearValue() {
+  value_.reset();
+}
+
+INPUT_PARSER_INLINE std::optional<Utf8Error> BaseOption::findInvalidUtf8(
+) const {
+  return findInvalidUtf8Value(value_);
 }
 
-BaseOption &BaseOption::transformBeforeCheck() {
+INPUT_PARSER_INLINE BaseOption &BaseOption::transformBeforeCheck() {
   transform_before_check_ = true;
   return *this;
 }
 
-BaseOption &BaseOption::beRequired(const bool required) {
+INPUT_PARSER_INLINE BaseOption &BaseOption::beRequired(const bool required) {
   required_ = required;
   return *this;
 }
 
-// ---------------------------- Private methods ---------------------------- //
+INPUT_PARSER_INLINE BaseOption &BaseOption::orderConstraintsAdaptively(
+  const bool adaptive
+) {
+  adaptive_order_ = adaptive;
+  constraint_order_.clear();
+  return *this;
+}
+
+INPUT_PARSER_INLINE BaseOption &BaseOption::hintConstraintCost(
+  const double nanoseconds
+) {
+  if (!constraints_.empty()) constraints_.back().setCostHint(nanoseconds);
+  constraint_order_.clear();
+  return *this;
+}
 
-void BaseOption::checkConstraints(const std::any &value) const {
+INPUT_PARSER_INLINE OptionMemoryUsage BaseOption::memoryUsage() const {
+  OptionMemoryUsage usage {.name = names_.front()};
+  usage.names = names_.capacity() * sizeof(std::string);
+  for (const auto &name : names_) usage.names += heapBytes(name);
+  usage.descriptions = heapBytes(description_) + heapBytes(argument_name_);
+  usage.value = heapBytes(value_);
+  usage.default_value = heapBytes(default_value_);
+  usage.constraints = constraints_.capacity() * sizeof(Constraint) +
+                      constraint_order_.capacity() * sizeof(std::size_t);
   for (const auto &constraint : constraints_) {
-    if (!constraint.call(value)) {
-      const std::string &error_message = constraint.getErrorMessage();
-      throw ParsingError(
-        error_message.empty() ? "Constraint not satisfied." : error_message
-      );
+    // Every constraint added keeps a copy of the user's std::function
+    usage.constraints += sizeof(std::function<bool(const std::any &)>) +
+                         heapBytes(constraint.getErrorMessage());
+  }
+  return usage;
+}
+
+// ---------------------------- Private methods ---------------------------- //
+
+INPUT_PARSER_INLINE Result<> BaseOption::checkConstraints(
+  const std::any &value
+) const {
+  const auto failure = [](const Constraint &constraint) {
+    const std::string &error_message = constraint.getErrorMessage();
+    return std::unexpected(ParsingError(
+      error_message.empty() ? "Constraint not satisfied." : error_message,
+      ErrorCode::kConstraintFailed
+    ));
+  };
+  if (!adaptive_order_) {
+    for (const auto &constraint : constraints_) {
+      if (!constraint.call(value)) return failure(constraint);
     }
+    return {};
+  }
+  if (constraint_order_.size() != constraints_.size() ||
+      ++checks_ % kReorderEvery == 0) {
+    sortConstraints();
+  }
+  for (const auto position : constraint_order_) {
+    const auto &constraint = constraints_[position];
+    if (!constraint.measuredCall(value)) return failure(constraint);
   }
+  return {};
+}
+
+INPUT_PARSER_INLINE void BaseOption::sortConstraints() const {
+  constraint_order_.resize(constraints_.size());
+  std::iota(constraint_order_.begin(), constraint_order_.end(), 0);
+  std::ranges::stable_sort(
+    constraint_order_, {},
+    [this](const std::size_t position) {
+      return constraints_[position].rejectionCost();
+    }
+  );
+}
+
+INPUT_PARSER_INLINE BaseOption &BaseOption::validUtf8() {
+  constraints_.emplace_back(
+    [](const std::any &value) {
+      return !findInvalidUtf8Value(value).has_value();
+    },
+    "The value of " + names_.front() + " is not valid UTF-8!"
+  );
+  // A single pass over the bytes of the value, cheap for most values
+  constraints_.back().setCostHint(20);
+  constraint_order_.clear();
+  return *this;
 }
 
 }  // namespace input_parser
\ No newline at end of file
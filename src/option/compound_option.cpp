@@ -1,25 +1,64 @@
+#include <any>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include <input_parser/config.hpp>
 #include <input_parser/option/compound_option.hpp>
+#include <input_parser/value_cast.hpp>
 
 namespace input_parser {
 
-CompoundOption &CompoundOption::toInt() {
-  return elementsTo<int>([](const std::string &str) -> int {
-    return std::stoi(str);
-  });
+namespace detail {
+
+/**
+ * @brief Reads the numbers of the values of a compound option, or the error
+ * of the first malformed one (see BaseOption::transform).
+ */
+template <class T>
+std::any compoundNumbers(const std::any &values) {
+  std::vector<T> numbers;
+  const auto read_all = [&](const auto &strings) -> Result<> {
+    numbers.reserve(strings.size());
+    for (const std::string_view text : strings) {
+      auto number = numberCast<T>(text);
+      if (!number) return std::unexpected(std::move(number.error()));
+      numbers.push_back(*number);
+    }
+    return {};
+  };
+  auto result = [&] {
+    if (const auto *list = std::any_cast<StringList>(&values)) {
+      return read_all(*list);
+    }
+    return read_all(valueCast<std::vector<std::string>>(values));
+  }();
+  if (!result) return std::move(result.error());
+  return numbers;
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE CompoundOption::CompoundOption(
+  std::vector<std::string> names
+) : BaseOption(std::move(names)) {
+  argument_name_ = " value1 value2 ...";
+}
+
+INPUT_PARSER_INLINE CompoundOption &CompoundOption::toInt() {
+  transformation_ = detail::compoundNumbers<int>;
+  return *this;
 }
 
-CompoundOption &CompoundOption::toDouble() {
-  return elementsTo<double>([](const std::string &str) -> double {
-    return std::stod(str);
-  });
+INPUT_PARSER_INLINE CompoundOption &CompoundOption::toDouble() {
+  transformation_ = detail::compoundNumbers<double>;
+  return *this;
 }
 
-CompoundOption &CompoundOption::toFloat() {
-  return elementsTo<float>([](const std::string &str) -> float {
-    return std::stof(str);
-  });
+INPUT_PARSER_INLINE CompoundOption &CompoundOption::toFloat() {
+  transformation_ = detail::compoundNumbers<float>;
+  return *this;
 }
 
 }  // namespace input_parser
\ No newline at end of file
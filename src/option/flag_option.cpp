@@ -1,18 +1,19 @@
+#include <input_parser/config.hpp>
 #include <input_parser/option/flag_option.hpp>
 
 namespace input_parser {
 
-FlagOption &FlagOption::toInt() {
+INPUT_PARSER_INLINE FlagOption &FlagOption::toInt() {
   return to<int>([](const bool &value) -> int { return value ? 1 : 0; });
 }
 
-FlagOption &FlagOption::toDouble() {
+INPUT_PARSER_INLINE FlagOption &FlagOption::toDouble() {
   return to<double>([](const bool &value) -> double {
     return value ? 1.0 : 0.0;
   });
 }
 
-FlagOption &FlagOption::toFloat() {
+INPUT_PARSER_INLINE FlagOption &FlagOption::toFloat() {
   return to<float>([](const bool &value) -> float {
     return value ? 1.0F : 0.0F;
   });
@@ -0,0 +1,77 @@
+/**
+ * @file option_family.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the families of options.
+ *
+ */
+
+#include <algorithm>
+#include <any>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <input_parser/config.hpp>
+#include <input_parser/option/option_family.hpp>
+
+namespace input_parser {
+
+INPUT_PARSER_INLINE std::vector<std::string_view>
+OptionFamily::getKeys() const {
+  std::vector<std::string_view> keys;
+  keys.reserve(values_.size());
+  for (const auto &[key, _] : values_) keys.emplace_back(key);
+  return keys;
+}
+
+INPUT_PARSER_INLINE std::optional<std::pair<std::string_view, Utf8Error>>
+OptionFamily::findInvalidUtf8() const {
+  for (const auto &[key, value] : values_) {
+    if (const auto error = findInvalidUtf8Value(value)) {
+      return std::pair<std::string_view, Utf8Error>(key, *error);
+    }
+  }
+  return std::nullopt;
+}
+
+INPUT_PARSER_INLINE OptionMemoryUsage OptionFamily::memoryUsage() const {
+  auto usage = prototype_.memoryUsage();
+  usage.value += values_.capacity() * sizeof(Entry);
+  for (const auto &[key, value] : values_) {
+    usage.value += heapBytes(key) + heapBytes(value);
+  }
+  return usage;
+}
+
+INPUT_PARSER_INLINE Result<> OptionFamily::trySetValue(
+  const std::string_view key, const std::any &value
+) {
+  auto converted = prototype_.convertValue(value);
+  if (!converted) return std::unexpected(converted.error());
+  const auto member = std::ranges::lower_bound(values_, key, {}, &Entry::first);
+  if (member != values_.end() && member->first == key) {
+    member->second = std::move(*converted);
+  } else {
+    values_.emplace(member, std::string(key), std::move(*converted));
+  }
+  return {};
+}
+
+INPUT_PARSER_INLINE void OptionFamily::clearValues() {
+  values_.clear();
+}
+
+INPUT_PARSER_INLINE std::vector<OptionFamily::Entry>::const_iterator
+OptionFamily::find(const std::string_view key) const {
+  const auto member = std::ranges::lower_bound(values_, key, {}, &Entry::first);
+  if (member != values_.end() && member->first == key) return member;
+  return values_.end();
+}
+
+}  // namespace input_parser
\ No newline at end of file
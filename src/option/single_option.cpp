@@ -1,25 +1,49 @@
+#include <any>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include <input_parser/config.hpp>
 #include <input_parser/option/single_option.hpp>
+#include <input_parser/value_cast.hpp>
 
 namespace input_parser {
 
-SingleOption &SingleOption::toInt() {
-  return to<int>([](const std::string &value) -> int {
-    return std::stoi(value);
-  });
+namespace detail {
+
+/**
+ * @brief Reads the number of the value of a single option, or the error of a
+ * malformed one (see BaseOption::transform).
+ */
+template <class T>
+std::any singleNumber(const std::any &value) {
+  const auto *text = std::any_cast<std::string>(&value);
+  auto number = text != nullptr ? numberCast<T>(*text)
+                                : numberCast<T>(valueCast<std::string>(value));
+  if (!number) return std::move(number.error());
+  return *number;
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE SingleOption::SingleOption(std::vector<std::string> names) :
+  BaseOption(std::move(names)) {
+  argument_name_ = " value";
+}
+
+INPUT_PARSER_INLINE SingleOption &SingleOption::toInt() {
+  transformation_ = detail::singleNumber<int>;
+  return *this;
 }
 
-SingleOption &SingleOption::toDouble() {
-  return to<double>([](const std::string &value) -> double {
-    return std::stod(value);
-  });
+INPUT_PARSER_INLINE SingleOption &SingleOption::toDouble() {
+  transformation_ = detail::singleNumber<double>;
+  return *this;
 }
 
-SingleOption &SingleOption::toFloat() {
-  return to<float>([](const std::string &value) -> float {
-    return std::stof(value);
-  });
+INPUT_PARSER_INLINE SingleOption &SingleOption::toFloat() {
+  transformation_ = detail::singleNumber<float>;
+  return *this;
 }
 
 }  // namespace input_parser
\ No newline at end of file
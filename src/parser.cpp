@@ -12,25 +12,212 @@
  *
  */
 
+#include <algorithm>
 #include <any>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#include <input_parser/config.hpp>
+#include <input_parser/glob.hpp>
+#include <input_parser/json_reader.hpp>
 #include <input_parser/parser.hpp>
 #include <input_parser/parsing_error.hpp>
+#include <input_parser/percent_decoding.hpp>
+#include <input_parser/record_stream.hpp>
 
 namespace input_parser {
 
+namespace detail {
+
+/**
+ * @brief Estimates the memory used by the nodes and the buckets of an
+ * unordered map with string keys.
+ *
+ * @return The bytes used by the nodes and the bytes used by the buckets.
+ */
+template <class Map>
+std::pair<std::size_t, std::size_t> mapMemoryUsage(const Map &map) {
+  // Every node stores the next node, the hash code and the key-value pair
+  std::size_t nodes = map.size() * (sizeof(void *) + sizeof(std::size_t) +
+                                    sizeof(typename Map::value_type));
+  for (const auto &[key, _] : map) nodes += heapBytes(key);
+  return {nodes, map.bucket_count() * sizeof(void *)};
+}
+
+/** @brief Creates the error of a limit exceeded (see ParseLimits) */
+INPUT_PARSER_COLD INPUT_PARSER_INLINE std::unexpected<ParsingError>
+limitExceeded(const std::string &message) {
+  return std::unexpected(ParsingError(message, ErrorCode::kLimitExceeded));
+}
+
+/** @brief Creates the error of a value that is not valid UTF-8 */
+INPUT_PARSER_COLD INPUT_PARSER_INLINE std::unexpected<ParsingError>
+invalidUtf8(
+  const std::string &name, const bool compound, const Utf8Error &error
+) {
+  const auto value = compound
+                     ? " value " + std::to_string(error.value + 1) + " of "
+                     : " value of ";
+  return std::unexpected(ParsingError(
+    "The" + value + name + " is not valid UTF-8 (byte " +
+      std::to_string(error.offset) + ")!",
+    ErrorCode::kConstraintFailed
+  ));
+}
+
+}  // namespace detail
+
 // ---------------------------- Static methods ---------------------------- //
 
-void Parser::setOptionValue(Option &option, const std::any &value) {
-  std::visit([&value](auto &&opt) { opt.setValue(value); }, option);
+INPUT_PARSER_INLINE Result<> Parser::setOptionValue(
+  Option &option, const std::any &value
+) {
+  return asBase(option).trySetValue(value);
+}
+
+// -------------------------------- Limits -------------------------------- //
+
+INPUT_PARSER_INLINE Result<> Parser::addValueTime(
+  const std::chrono::nanoseconds spent
+) {
+  value_time_ += spent;
+  if (value_time_ > limits_.max_value_time) {
+    return detail::limitExceeded("Setting the values took too long!");
+  }
+  return {};
+}
+
+INPUT_PARSER_INLINE Result<std::pmr::vector<std::string_view>>
+Parser::readArguments(const unsigned int argc, char *raw_argv[]) const {
+  if (argc > 0 && argc - 1 > limits_.max_arguments) {
+    return detail::limitExceeded("Too many arguments provided!");
+  }
+  // Reading one character past the limit is enough to know it was exceeded
+  const auto max_length = limits_.max_argument_length;
+  const auto read_length = max_length == std::numeric_limits<std::size_t>::max()
+                           ? max_length
+                           : max_length + 1;
+  std::pmr::vector<std::string_view> argv(resource_);
+  argv.reserve(argc);
+  std::size_t total_bytes = 0;
+  for (unsigned int index = 0; index < argc; ++index) {
+    const auto length = strnlen(raw_argv[index], read_length);
+    if (length > max_length) {
+      return detail::limitExceeded("An argument is too long!");
+    }
+    total_bytes += length;
+    if (total_bytes > limits_.max_total_bytes) {
+      return detail::limitExceeded("The arguments provided are too long!");
+    }
+    argv.emplace_back(raw_argv[index], length);
+  }
+  return argv;
+}
+
+INPUT_PARSER_INLINE Result<std::pmr::vector<std::string_view>>
+Parser::splitCmdline(std::string_view cmdline) const {
+  if (cmdline.size() > limits_.max_total_bytes) {
+    return detail::limitExceeded("The arguments provided are too long!");
+  }
+  std::pmr::vector<std::string_view> argv(resource_);
+  while (!cmdline.empty()) {
+    const auto *end = static_cast<const char *>(
+      std::memchr(cmdline.data(), '\0', cmdline.size())
+    );
+    const auto length = end == nullptr
+                        ? cmdline.size()
+                        : static_cast<std::size_t>(end - cmdline.data());
+    if (length > limits_.max_argument_length) {
+      return detail::limitExceeded("An argument is too long!");
+    }
+    // The program name is not counted, like in readArguments
+    if (argv.size() > limits_.max_arguments) {
+      return detail::limitExceeded("Too many arguments provided!");
+    }
+    argv.push_back(cmdline.substr(0, length));
+    cmdline.remove_prefix(std::min(length + 1, cmdline.size()));
+  }
+  return argv;
 }
 
 // -------------------------------- Adders -------------------------------- //
 
-Parser &Parser::addHelpOption() {
+INPUT_PARSER_INLINE void Parser::insertOption(Option option) {
+  const auto &names = asBase(option).getNames();
+  const auto reference_name = std::pmr::string(names.front(), resource_);
+  for (const auto &name : names) {
+    if (hasOption(name)) {
+      raiseError("Option already exists!", ErrorCode::kDuplicateOption);
+    }
+    names_.emplace(name, reference_name);
+    name_filter_.add(name);
+    if (pathOf(name).contains('.')) {
+      paths_.emplace(
+        std::ranges::upper_bound(paths_, pathOf(name), pathLess, pathOf), name
+      );
+    }
+  }
+  if (const auto *flag = std::get_if<FlagOption>(&option)) addFlag(*flag);
+  options_.emplace(reference_name, std::move(option));
+}
+
+INPUT_PARSER_INLINE void Parser::insertFamily(SingleOption prototype) {
+  const auto id = families_.size();
+  for (const auto &pattern : prototype.getNames()) {
+    if (!PatternMatcher::isPattern(pattern)) {
+      raiseError(ParsingError(
+        "The pattern " + pattern + " must have a single asterisk",
+        ErrorCode::kInvalidArguments
+      ));
+    }
+    if (family_ids_.contains(std::string_view(pattern))) {
+      raiseError("Option already exists!", ErrorCode::kDuplicateOption);
+    }
+  }
+  for (const auto &pattern : prototype.getNames()) {
+    family_ids_.emplace(pattern, id);
+    patterns_.add(pattern, id);
+  }
+  families_.emplace_back(std::move(prototype));
+}
+
+INPUT_PARSER_INLINE void Parser::adoptOption(
+  const SchemaOption &option, const std::span<const std::string_view> names
+) {
+  auto option_names = std::vector<std::string>(names.begin(), names.end());
+  auto adopted = [&]() -> Option {
+    switch (option.kind) {
+      case OptionKind::kFlag:
+        return FlagOption(std::move(option_names)).addDefaultValue(false);
+      case OptionKind::kSingle:
+        return SingleOption(std::move(option_names));
+      default:
+        return CompoundOption(std::move(option_names));
+    }
+  }();
+  asBase(adopted)
+    .addDescription(std::string(option.description))
+    .beRequired(option.required);
+  insertOption(std::move(adopted));
+}
+
+INPUT_PARSER_INLINE void Parser::addFlag(const FlagOption &flag) {
+  const auto id = flag_names_.size();
+  for (const auto &name : flag.getNames()) flag_ids_.emplace(name, id);
+  flag_names_.emplace_back(flag.getNames().front());
+  flags_.resize(id + 1);
+  flags_.set(id, flag.getDefaultState());
+}
+
+INPUT_PARSER_INLINE Parser &Parser::addHelpOption() {
   return addOption([] {
     return FlagOption("-h", "--help")
       .addDescription("Shows how to use the program.")
@@ -38,102 +225,578 @@ Parser &Parser::addHelpOption() {
   });
 }
 
-void Parser::parse(unsigned int argc, char *raw_argv[]) {
-  const std::vector<std::string> argv(raw_argv, raw_argv + argc);
-  for (unsigned int index = 1; index < argc; ++index) {
-    if (!hasOption(argv[index])) {
-      throw ParsingError("Invalid arguments provided!");
-    }
+INPUT_PARSER_INLINE void Parser::parse(unsigned int argc, char *raw_argv[]) {
+  if (auto result = tryParse(argc, raw_argv); !result) {
+    raiseError(result.error());
+  }
+}
+
+INPUT_PARSER_INLINE Result<> Parser::tryParse(
+  unsigned int argc, char *raw_argv[]
+) {
+  value_time_ = {};
+  const auto arguments = readArguments(argc, raw_argv);
+  if (!arguments) return std::unexpected(arguments.error());
+  return parseArguments(*arguments);
+}
+
+INPUT_PARSER_INLINE void Parser::parseCmdline(const std::string_view cmdline) {
+  if (auto result = tryParseCmdline(cmdline); !result) {
+    raiseError(result.error());
+  }
+}
+
+INPUT_PARSER_INLINE Result<> Parser::tryParseCmdline(
+  const std::string_view cmdline
+) {
+  value_time_ = {};
+  const auto arguments = splitCmdline(cmdline);
+  if (!arguments) return std::unexpected(arguments.error());
+  return parseArguments(*arguments);
+}
+
+INPUT_PARSER_INLINE Result<> Parser::parseArguments(
+  const std::span<const std::string_view> argv
+) {
+  for (unsigned int index = 1; index < argv.size(); ++index) {
+    Result<unsigned int> arguments_read = 0;
     if (hasFlag(argv[index])) {
-      parseFlag(argv[index]);
+      arguments_read = parseFlag(argv[index]);
     } else if (hasSingle(argv[index])) {
-      index += parseSingle(argv, index);
+      arguments_read = parseSingle(argv, index);
     } else if (hasCompound(argv[index])) {
-      index += parseCompound(argv, index);
+      arguments_read = parseCompound(argv, index);
+    } else if (const auto member = patterns_.match(argv[index])) {
+      arguments_read = parseFamily(argv, index, *member);
+    } else if (ignore_unknown_) {
+      continue;
+    } else {
+      return std::unexpected(ParsingError(
+        "Invalid arguments provided!", ErrorCode::kInvalidArguments
+      ));
+    }
+    if (!arguments_read) return std::unexpected(arguments_read.error());
+    index += *arguments_read;
+  }
+  if (auto result = checkHelpOption(); !result) return result;
+  if (auto result = checkUtf8Values(); !result) return result;
+  return checkMissingOptions();
+}
+
+INPUT_PARSER_INLINE void Parser::parseQuery(const std::string_view query) {
+  if (auto result = tryParseQuery(query); !result) raiseError(result.error());
+}
+
+INPUT_PARSER_INLINE Result<> Parser::tryParseQuery(std::string_view query) {
+  value_time_ = {};
+  if (query.starts_with('?')) query.remove_prefix(1);
+  if (query.size() > limits_.max_total_bytes) {
+    return detail::limitExceeded("The arguments provided are too long!");
+  }
+  std::string key_buffer;
+  std::string value_buffer;
+  // The values of the compound options, set once every key is read
+  std::pmr::vector<std::pair<Option *, StringList>> compounds(resource_);
+  std::size_t arguments = 0;
+  while (!query.empty()) {
+    const auto end = std::min(query.find('&'), query.size());
+    const auto pair = query.substr(0, end);
+    query.remove_prefix(std::min(end + 1, query.size()));
+    if (pair.empty()) continue;
+    if (++arguments > limits_.max_arguments) {
+      return detail::limitExceeded("Too many arguments provided!");
     }
+    if (pair.size() > limits_.max_argument_length) {
+      return detail::limitExceeded("An argument is too long!");
+    }
+    const auto equals = pair.find('=');
+    const auto key = percentDecode(pair.substr(0, equals), key_buffer);
+    if (!key) return std::unexpected(key.error());
+    const auto *name = findKey(*key);
+    if (name == nullptr && ignore_unknown_) continue;
+    if (name == nullptr) {
+      return std::unexpected(ParsingError(
+        "Invalid arguments provided!", ErrorCode::kInvalidArguments
+      ));
+    }
+    auto &option = getOption(*name);
+    const auto &base = asBase(option);
+    if (equals == std::string_view::npos && !base.isFlag()) {
+      return std::unexpected(ParsingError(
+        "After the " + std::string(*name) +
+          " option should be an extra argument!",
+        ErrorCode::kMissingArgument
+      ));
+    }
+    const auto value = equals == std::string_view::npos
+                       ? Result<std::string_view>("true")
+                       : percentDecode(pair.substr(equals + 1), value_buffer);
+    if (!value) return std::unexpected(value.error());
+    Result<> result;
+    if (base.isFlag()) {
+      result = setFlagState(*name, *value);
+    } else if (base.isSingle()) {
+      result = setSingleValue(option, *value);
+    } else {
+      auto compound = std::ranges::find(
+        compounds, &option, &std::pair<Option *, StringList>::first
+      );
+      if (compound == compounds.end()) {
+        compound = compounds.emplace(compounds.end(), &option, StringList());
+      }
+      if (compound->second.size() == limits_.max_compound_values) {
+        return detail::limitExceeded(
+          "Too many values provided to the " + std::string(*name) + " option!"
+        );
+      }
+      compound->second.push_back(*value);
+    }
+    if (!result) return result;
+  }
+  for (auto &[option, values] : compounds) {
+    if (auto result = setCompoundValues(*option, values); !result) {
+      return result;
+    }
+  }
+  if (auto result = checkHelpOption(); !result) return result;
+  if (auto result = checkUtf8Values(); !result) return result;
+  return checkMissingOptions();
+}
+
+INPUT_PARSER_INLINE void Parser::parseJson(const std::string_view json) {
+  if (auto result = tryParseJson(json); !result) raiseError(result.error());
+}
+
+INPUT_PARSER_INLINE Result<> Parser::tryParseJson(const std::string_view json) {
+  value_time_ = {};
+  if (json.size() > limits_.max_total_bytes) {
+    return detail::limitExceeded("The arguments provided are too long!");
+  }
+  JsonReader reader(json);
+  if (auto result = readJsonObject(reader, "", 0); !result) return result;
+  if (auto result = reader.finish(); !result) return result;
+  if (auto result = checkHelpOption(); !result) return result;
+  if (auto result = checkUtf8Values(); !result) return result;
+  return checkMissingOptions();
+}
+
+INPUT_PARSER_INLINE void Parser::reset() {
+  for (auto &[name, option] : options_) {
+    asBase(option).clearValue();
+    if (const auto *flag = std::get_if<FlagOption>(&option)) {
+      flags_.set(flag_ids_.find(name)->second, flag->getDefaultState());
+    }
+  }
+  for (auto &family : families_) family.clearValues();
+}
+
+// -------------------------------- Getters ------------------------------- //
+
+INPUT_PARSER_INLINE std::size_t Parser::getFlagId(
+  const std::string_view name
+) const {
+  const auto flag_id = flag_ids_.find(name);
+  if (flag_id == flag_ids_.end()) {
+    raiseError(ParsingError(
+      "The flag " + std::string(name) + " was not assigned",
+      ErrorCode::kUnknownOption
+    ));
+  }
+  return flag_id->second;
+}
+
+INPUT_PARSER_INLINE const OptionFamily &Parser::getFamily(
+  const std::string_view pattern
+) const {
+  const auto family_id = family_ids_.find(pattern);
+  if (family_id == family_ids_.end()) {
+    raiseError(ParsingError(
+      "The family " + std::string(pattern) + " was not assigned",
+      ErrorCode::kUnknownOption
+    ));
   }
-  checkHelpOption();
-  checkMissingOptions();
+  return families_[family_id->second];
+}
+
+INPUT_PARSER_INLINE Parser::Subtree Parser::getSubtree(
+  const std::string_view path
+) const {
+  return Subtree(this, 0, paths_.begin(), paths_.end()).getSubtree(path);
+}
+
+INPUT_PARSER_INLINE FlagSet Parser::makeFlagGroup(
+  const std::initializer_list<std::string_view> names
+) const {
+  auto group = FlagSet(flags_.size());
+  for (const auto name : names) group.set(getFlagId(name));
+  return group;
+}
+
+INPUT_PARSER_INLINE const std::pmr::string *Parser::findKey(
+  const std::string_view key
+) const {
+  // Most names fit in the buffer, so finding them does not allocate
+  std::array<char, 64> buffer;
+  std::string long_name;
+  for (const std::string_view dashes : {"--", "-"}) {
+    std::string_view name;
+    if (dashes.size() + key.size() <= buffer.size()) {
+      std::ranges::copy(key, std::ranges::copy(dashes, buffer.begin()).out);
+      name = std::string_view(buffer.data(), dashes.size() + key.size());
+    } else {
+      name = long_name.assign(dashes).append(key);
+    }
+    if (hasOption(name)) return &names_.find(name)->second;
+  }
+  return nullptr;
+}
+
+INPUT_PARSER_INLINE Result<> Parser::readJsonObject(
+  JsonReader &reader, const std::string &prefix, const std::size_t depth
+) {
+  if (depth == kMaxJsonDepth) {
+    return detail::limitExceeded("The JSON objects are nested too deeply!");
+  }
+  if (auto result = reader.enter('{'); !result) return result;
+  std::string key_buffer;
+  std::string path;
+  for (bool first = true;; first = false) {
+    const auto key = reader.nextKey(first, key_buffer);
+    if (!key) return std::unexpected(key.error());
+    if (!key->has_value()) return {};
+    path.assign(prefix).append(**key);
+    if (const auto *name = findKey(path); name != nullptr) {
+      if (auto result = readJsonValue(reader, *name); !result) return result;
+      continue;
+    }
+    const auto kind = reader.peek();
+    if (!kind) return std::unexpected(kind.error());
+    if (*kind != JsonKind::kObject && ignore_unknown_) {
+      if (auto result = reader.skip(); !result) return result;
+      continue;
+    }
+    if (*kind != JsonKind::kObject) {
+      return std::unexpected(ParsingError(
+        "Invalid arguments provided!", ErrorCode::kInvalidArguments
+      ));
+    }
+    path.push_back('.');
+    if (auto result = readJsonObject(reader, path, depth + 1); !result) {
+      return result;
+    }
+  }
+}
+
+INPUT_PARSER_INLINE Result<> Parser::readJsonValue(
+  JsonReader &reader, const std::pmr::string &name
+) {
+  const auto kind = reader.peek();
+  if (!kind) return std::unexpected(kind.error());
+  if (*kind == JsonKind::kNull) return reader.skip();
+  auto &option = getOption(name);
+  const auto &base = asBase(option);
+  std::string buffer;
+  if (base.isFlag()) {
+    if (*kind != JsonKind::kBoolean) {
+      return std::unexpected(ParsingError(
+        "The flag " + std::string(name) + " only accepts true or false!",
+        ErrorCode::kInvalidArguments
+      ));
+    }
+    const auto state = reader.readScalar(buffer);
+    if (!state) return std::unexpected(state.error());
+    return setFlagState(name, *state);
+  }
+  if (base.isSingle()) {
+    const auto value = reader.readScalar(buffer);
+    if (!value) return std::unexpected(value.error());
+    if (value->size() > limits_.max_argument_length) {
+      return detail::limitExceeded("An argument is too long!");
+    }
+    return setSingleValue(option, *value);
+  }
+  StringList values;
+  const bool is_array = *kind == JsonKind::kArray;
+  if (is_array) {
+    if (auto result = reader.enter('['); !result) return result;
+  }
+  for (bool first = true;; first = false) {
+    if (is_array) {
+      const auto more = reader.nextElement(first);
+      if (!more) return std::unexpected(more.error());
+      if (!*more) break;
+    } else if (!first) {
+      break;
+    }
+    if (values.size() == limits_.max_compound_values) {
+      return detail::limitExceeded(
+        "Too many values provided to the " + std::string(name) + " option!"
+      );
+    }
+    const auto value = reader.readScalar(buffer);
+    if (!value) return std::unexpected(value.error());
+    if (value->size() > limits_.max_argument_length) {
+      return detail::limitExceeded("An argument is too long!");
+    }
+    values.push_back(*value);
+  }
+  return setCompoundValues(option, values);
+}
+
+// -------------------------------- Paths --------------------------------- //
+
+INPUT_PARSER_INLINE bool Parser::pathLess(
+  const std::string_view lhs, const std::string_view rhs
+) {
+  const auto rank = [](const char character) {
+    return character == '.' ? 0 : static_cast<unsigned char>(character) + 1;
+  };
+  return std::ranges::lexicographical_compare(lhs, rhs, {}, rank, rank);
+}
+
+INPUT_PARSER_INLINE std::optional<std::string_view> Parser::Subtree::find(
+  const std::string_view relative_path
+) const {
+  const auto found =
+    std::ranges::lower_bound(begin_, end_, relative_path, pathLess, relative());
+  if (found == end_ || relative()(*found) != relative_path) return std::nullopt;
+  return *found;
+}
+
+INPUT_PARSER_INLINE Parser::Subtree Parser::Subtree::getSubtree(
+  const std::string_view relative_path
+) const {
+  if (relative_path.empty()) return *this;
+  // The paths inside the subtree are the path itself or start with "path."
+  const auto inside = [relative_path](const std::string_view path) {
+    return path.starts_with(relative_path) &&
+           (path.size() == relative_path.size() ||
+            path[relative_path.size()] == '.');
+  };
+  const auto begin =
+    std::ranges::lower_bound(begin_, end_, relative_path, pathLess, relative());
+  const auto end = std::partition_point(begin, end_, [&](const auto &name) {
+    return inside(relative()(name));
+  });
+  const auto depth =
+    depth_ == 0 ? relative_path.size() : depth_ + 1 + relative_path.size();
+  return Subtree(parser_, depth, begin, end);
 }
 
 // -------------------------------- Checks -------------------------------- //
 
-bool Parser::hasFlag(const std::string &name) const {
-  return hasOption(name) &&
-         std::visit([](auto &&opt) { return opt.isFlag(); }, getOption(name));
+INPUT_PARSER_INLINE bool Parser::hasFlag(const std::string_view name) const {
+  return hasOption(name) && asBase(getOption(name)).isFlag();
 }
 
-bool Parser::hasSingle(const std::string &name) const {
-  return hasOption(name) &&
-         std::visit([](auto &&opt) { return opt.isSingle(); }, getOption(name));
+INPUT_PARSER_INLINE bool Parser::hasSingle(const std::string_view name) const {
+  return hasOption(name) && asBase(getOption(name)).isSingle();
 }
 
-bool Parser::hasCompound(const std::string &name) const {
-  return hasOption(name) &&
-         std::visit(
-           [](auto &&opt) { return opt.isCompound(); }, getOption(name)
-         );
+INPUT_PARSER_INLINE bool Parser::hasCompound(
+  const std::string_view name
+) const {
+  return hasOption(name) && asBase(getOption(name)).isCompound();
 }
 
-void Parser::checkMissingOptions() const {
+INPUT_PARSER_INLINE Result<> Parser::checkMissingOptions() const {
   for (const auto &[_, option] : options_) {
-    std::visit(
-      [](auto &&opt) {
-        if (opt.isRequired() && !opt.hasValue() && !opt.hasDefaultValue()) {
-          throw ParsingError("Missing option " + opt.getNames()[0]);
-        }
-      },
-      option
-    );
+    const auto &opt = asBase(option);
+    if (opt.isRequired() && !opt.hasValue() && !opt.hasDefaultValue()) {
+      return std::unexpected(ParsingError(
+        "Missing option " + opt.getNames()[0], ErrorCode::kMissingOption
+      ));
+    }
   }
+  return {};
 }
 
-void Parser::checkHelpOption() const {
-  if (hasOption("-h") && getValue<bool>("-h")) { throw ParsingError(usage()); }
+INPUT_PARSER_INLINE Result<> Parser::checkHelpOption() const {
+  if (hasOption("-h") && getValue<bool>("-h")) {
+    return std::unexpected(ParsingError(usage(), ErrorCode::kHelpRequested));
+  }
+  return {};
+}
+
+INPUT_PARSER_INLINE Result<> Parser::checkUtf8Values() const {
+  if (!require_utf8_) return {};
+  // The map is unordered, so the invalid option with the lowest name is kept
+  const Option *invalid_option = nullptr;
+  std::string_view invalid_name;
+  Utf8Error invalid_error {};
+  for (const auto &[name, option] : options_) {
+    const auto &base = asBase(option);
+    if (!base.hasValue()) continue;
+    if (invalid_option != nullptr && name >= invalid_name) continue;
+    if (const auto error = base.findInvalidUtf8()) {
+      invalid_option = &option;
+      invalid_name = name;
+      invalid_error = *error;
+    }
+  }
+  if (invalid_option != nullptr) {
+    return detail::invalidUtf8(
+      std::string(invalid_name), asBase(*invalid_option).isCompound(),
+      invalid_error
+    );
+  }
+  for (const auto &family : families_) {
+    const auto invalid = family.findInvalidUtf8();
+    if (!invalid) continue;
+    // The name of the member is its pattern with the key in the asterisk
+    auto name = family.getPrototype().getNames().front();
+    name.replace(name.find('*'), 1, invalid->first);
+    return detail::invalidUtf8(name, false, invalid->second);
+  }
+  return {};
 }
 
 // -------------------------- Individual parsers -------------------------- //
 
-void Parser::parseFlag(const std::string &flag_name) {
-  std::visit(
-    [](auto &&opt) {
-      opt.setValue(
-        opt.hasDefaultValue() ? !opt.template getDefaultValue<bool>() : true
-      );
-    },
-    getOption(flag_name)
-  );
+INPUT_PARSER_INLINE Result<unsigned int> Parser::parseFlag(
+  const std::string_view flag_name
+) {
+  auto &option = getOption(flag_name);
+  const bool state = !std::get<FlagOption>(option).getDefaultState();
+  const auto result = setLimitedValue([&] {
+    return setOptionValue(option, state);
+  });
+  if (!result) return std::unexpected(result.error());
+  flags_.set(flag_ids_.find(flag_name)->second, state);
+  return 0;
 }
 
-unsigned int Parser::parseSingle(
-  const std::vector<std::string> &arguments, const unsigned int index
+INPUT_PARSER_INLINE Result<unsigned int> Parser::parseSingle(
+  const std::span<const std::string_view> arguments, const unsigned int index
 ) {
-  if (index + 1 >= arguments.size() || hasOption(arguments[index + 1])) {
-    throw ParsingError(
-      "After the " + arguments[index] + " option should be an extra argument!"
-    );
+  if (index + 1 >= arguments.size() || isName(arguments[index + 1])) {
+    return std::unexpected(ParsingError(
+      "After the " + std::string(arguments[index]) +
+        " option should be an extra argument!",
+      ErrorCode::kMissingArgument
+    ));
   }
-  Parser::setOptionValue(getOption(arguments[index]), arguments[index + 1]);
+  auto result =
+    setSingleValue(getOption(arguments[index]), arguments[index + 1]);
+  if (!result) return std::unexpected(result.error());
   return 1;
 }
 
-unsigned int Parser::parseCompound(
-  const std::vector<std::string> &arguments, const unsigned int index
+INPUT_PARSER_INLINE Result<> Parser::setFlagState(
+  const std::string_view flag_name, const std::string_view state
+) {
+  if (state == "false" || state == "0") return {};
+  if (state != "true" && state != "1") {
+    return std::unexpected(ParsingError(
+      "The flag " + std::string(flag_name) + " only accepts true or false!",
+      ErrorCode::kInvalidArguments
+    ));
+  }
+  if (auto result = parseFlag(flag_name); !result) {
+    return std::unexpected(result.error());
+  }
+  return {};
+}
+
+INPUT_PARSER_INLINE Result<> Parser::setSingleValue(
+  Option &option, const std::string_view value
+) {
+  auto result = setLimitedValue([&] {
+    return setOptionValue(option, std::string(value));
+  });
+  if (!result) return result;
+  if (interner_ != nullptr) asBase(option).internValue(*interner_);
+  return {};
+}
+
+INPUT_PARSER_INLINE Result<> Parser::setCompoundValues(
+  Option &option, const StringList &values
+) {
+  if (!std::get<CompoundOption>(option).expandsGlobs()) {
+    return setLimitedValue([&] { return setOptionValue(option, values); });
+  }
+  StringList expanded;
+  for (const auto value : values) {
+    if (!isGlobPattern(value)) {
+      if (expanded.size() == limits_.max_compound_values) {
+        return detail::limitExceeded(
+          "Too many values matched by the glob pattern!"
+        );
+      }
+      expanded.push_back(value);
+    } else if (auto result = expandGlob(value, expanded, limits_); !result) {
+      return result;
+    }
+  }
+  return setLimitedValue([&] { return setOptionValue(option, expanded); });
+}
+
+INPUT_PARSER_INLINE Result<unsigned int> Parser::parseCompound(
+  const std::span<const std::string_view> arguments, const unsigned int index
 ) {
-  std::vector<std::string> values {};
   auto local_index = index + 1;
-  while (local_index < arguments.size() && !hasOption(arguments[local_index])) {
-    values.push_back(arguments[local_index]);
+  std::size_t characters = 0;
+  while (local_index < arguments.size() && !isName(arguments[local_index])) {
+    characters += arguments[local_index].size();
     ++local_index;
+    if (local_index - index - 1 > limits_.max_compound_values) {
+      return detail::limitExceeded(
+        "Too many values provided to the " + std::string(arguments[index]) +
+        " option!"
+      );
+    }
   }
   if (local_index == index + 1) {
-    throw ParsingError(
-      "After the " + arguments[index] +
-      " option should be at least an extra argument!"
-    );
+    return std::unexpected(ParsingError(
+      "After the " + std::string(arguments[index]) +
+        " option should be at least an extra argument!",
+      ErrorCode::kMissingArgument
+    ));
+  }
+  const auto values_read = local_index - index - 1;
+  auto &option = getOption(arguments[index]);
+  const auto delimiter = std::get<CompoundOption>(option).getStreamDelimiter();
+  const auto descriptor =
+    delimiter && values_read == 1 ? streamDescriptor(arguments[index + 1])
+                                  : std::nullopt;
+  StringList values;
+  if (descriptor) {
+    if (auto result = readRecords(*descriptor, *delimiter, values, limits_);
+        !result) {
+      return std::unexpected(result.error());
+    }
+  } else {
+    values.reserve(values_read, characters);
+    for (const auto value : arguments.subspan(index + 1, values_read)) {
+      values.push_back(value);
+    }
   }
-  Parser::setOptionValue(getOption(arguments[index]), values);
-  return local_index - index - 1;
+  // The records of a stream are paths already, never patterns
+  auto result =
+    descriptor
+      ? setLimitedValue([&] { return setOptionValue(option, values); })
+      : setCompoundValues(option, values);
+  if (!result) return std::unexpected(result.error());
+  return values_read;
+}
+
+INPUT_PARSER_INLINE Result<unsigned int> Parser::parseFamily(
+  const std::span<const std::string_view> arguments, const unsigned int index,
+  const PatternMatch &member
+) {
+  if (index + 1 >= arguments.size() || isName(arguments[index + 1])) {
+    return std::unexpected(ParsingError(
+      "After the " + std::string(arguments[index]) +
+        " option should be an extra argument!",
+      ErrorCode::kMissingArgument
+    ));
+  }
+  auto &family = families_[member.id];
+  const auto result = setLimitedValue([&] {
+    return family.trySetValue(member.key, std::string(arguments[index + 1]));
+  });
+  if (!result) return std::unexpected(result.error());
+  return 1;
 }
 
 /**
@@ -182,25 +845,59 @@ unsigned int Parser::parseCompound(
 // author << "\n";
 //
 
-std::string Parser::usage() const {
+INPUT_PARSER_INLINE std::string Parser::usage() const {
   std::string usage = "Usage: ./exec_name";
   std::string description;
   for (const auto &[option_name, option] : options_) {
-    std::visit(
-      [&](auto &&opt) {
-        const std::pair<std::string, std::string> brackets_or_not =
-          opt.isRequired() ? std::make_pair("<", ">")
-                           : std::make_pair("[", "]");
-        usage += " " + brackets_or_not.first + option_name +
-                 opt.getArgumentName() + brackets_or_not.second;
-        if (opt.getDescription() != "") {
-          description += option_name + " -> " + opt.getDescription() + "\n";
-        }
-      },
-      option
-    );
+    const auto &opt = asBase(option);
+    const std::pair<std::string, std::string> brackets_or_not =
+      opt.isRequired() ? std::make_pair("<", ">") : std::make_pair("[", "]");
+    usage += " " + brackets_or_not.first;
+    usage.append(option_name);
+    usage += opt.getArgumentName() + brackets_or_not.second;
+    if (opt.getDescription() != "") {
+      description.append(option_name);
+      description += " -> " + opt.getDescription() + "\n";
+    }
+  }
+  for (const auto &family : families_) {
+    const auto &prototype = family.getPrototype();
+    const auto &pattern = prototype.getNames().front();
+    usage += " [" + pattern + prototype.getArgumentName() + "]";
+    if (prototype.getDescription() != "") {
+      description += pattern + " -> " + prototype.getDescription() + "\n";
+    }
   }
   return usage + "\n\n" + description + "\n";
 }
 
+INPUT_PARSER_INLINE MemoryUsage Parser::memoryUsage() const {
+  MemoryUsage usage;
+  std::tie(usage.options_nodes, usage.options_buckets) =
+    detail::mapMemoryUsage(options_);
+  std::tie(usage.names_nodes, usage.names_buckets) =
+    detail::mapMemoryUsage(names_);
+  for (const auto &[_, reference_name] : names_) {
+    usage.names_nodes += heapBytes(reference_name);
+  }
+  usage.names_nodes += paths_.capacity() * sizeof(std::pmr::string);
+  for (const auto &name : paths_) usage.names_nodes += heapBytes(name);
+  const auto [flag_nodes, flag_buckets] = detail::mapMemoryUsage(flag_ids_);
+  usage.flags = flag_nodes + flag_buckets +
+                flag_names_.capacity() * sizeof(std::pmr::string) +
+                flags_.words().size() * sizeof(FlagSet::Word);
+  for (const auto &name : flag_names_) usage.flags += heapBytes(name);
+  usage.options.reserve(options_.size() + families_.size());
+  for (const auto &[_, option] : options_) {
+    usage.options.push_back(asBase(option).memoryUsage());
+  }
+  for (const auto &family : families_) {
+    usage.options.push_back(family.memoryUsage());
+  }
+  std::ranges::sort(
+    usage.options, std::ranges::greater {}, &OptionMemoryUsage::total
+  );
+  return usage;
+}
+
 }  // namespace input_parser
\ No newline at end of file
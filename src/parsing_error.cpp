@@ -0,0 +1,52 @@
+/**
+ * @file parsing_error.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the way the errors that can
+ * not be returned are reported.
+ *
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#include <input_parser/config.hpp>
+#include <input_parser/parsing_error.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+// The handler installed by the user (if any)
+INPUT_PARSER_INLINE std::atomic<ErrorHandler> error_handler {nullptr};
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE ErrorHandler setErrorHandler(const ErrorHandler handler) {
+  return detail::error_handler.exchange(handler);
+}
+
+INPUT_PARSER_INLINE void raiseError(const ParsingError &error) {
+  if (const auto handler = detail::error_handler.load(); handler != nullptr) {
+    handler(error);
+  }
+#ifdef INPUT_PARSER_NO_EXCEPTIONS
+  std::fputs(error.what(), stderr);
+  std::fputc('\n', stderr);
+  std::abort();
+#else
+  throw error;
+#endif
+}
+
+INPUT_PARSER_INLINE void raiseError(
+  const char *const message, const ErrorCode code
+) {
+  raiseError(ParsingError(message, code));
+}
+
+}  // namespace input_parser
\ No newline at end of file
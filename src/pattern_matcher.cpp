@@ -0,0 +1,76 @@
+/**
+ * @file pattern_matcher.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the matcher of name patterns.
+ *
+ */
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+#include <input_parser/config.hpp>
+#include <input_parser/pattern_matcher.hpp>
+
+namespace input_parser {
+
+INPUT_PARSER_INLINE void PatternMatcher::add(
+  const std::string_view pattern, const std::size_t id
+) {
+  const auto asterisk = pattern.find('*');
+  std::uint32_t node = 0;
+  for (const char character : pattern.substr(0, asterisk)) {
+    if (const auto next = child(node, character)) {
+      node = *next;
+      continue;
+    }
+    const auto next = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    auto &children = nodes_[node].children;
+    children.insert(
+      std::ranges::lower_bound(
+        children, character, {}, &std::pair<char, std::uint32_t>::first
+      ),
+      {character, next}
+    );
+    node = next;
+  }
+  nodes_[node].endings.emplace_back(pattern.substr(asterisk + 1), id);
+}
+
+INPUT_PARSER_INLINE std::optional<PatternMatch> PatternMatcher::match(
+  const std::string_view name
+) const {
+  std::optional<PatternMatch> found;
+  std::uint32_t node = 0;
+  for (std::size_t length = 0;; ++length) {
+    for (const auto &[suffix, id] : nodes_[node].endings) {
+      if (name.size() > length + suffix.size() && name.ends_with(suffix)) {
+        found = {id, name.substr(length, name.size() - length - suffix.size())};
+        break;
+      }
+    }
+    if (length == name.size()) break;
+    const auto next = child(node, name[length]);
+    if (!next) break;
+    node = *next;
+  }
+  return found;
+}
+
+INPUT_PARSER_INLINE std::optional<std::uint32_t> PatternMatcher::child(
+  const std::uint32_t node, const char character
+) const {
+  const auto &children = nodes_[node].children;
+  const auto found = std::ranges::lower_bound(
+    children, character, {}, &std::pair<char, std::uint32_t>::first
+  );
+  if (found == children.end() || found->first != character) return std::nullopt;
+  return found->second;
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,66 @@
+/**
+ * @file percent_decoding.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the decoding of the query
+ * strings.
+ *
+ */
+
+#include <string>
+#include <string_view>
+
+#include <input_parser/config.hpp>
+#include <input_parser/parsing_error.hpp>
+#include <input_parser/percent_decoding.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+/** @brief Gets the value of a hexadecimal digit, or -1 if it is not one */
+INPUT_PARSER_INLINE int hexValue(const char digit) {
+  if (digit >= '0' && digit <= '9') return digit - '0';
+  if (digit >= 'a' && digit <= 'f') return digit - 'a' + 10;
+  if (digit >= 'A' && digit <= 'F') return digit - 'A' + 10;
+  return -1;
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE Result<std::string_view> percentDecode(
+  const std::string_view text, std::string &buffer
+) {
+  auto position = text.find_first_of("%+");
+  if (position == std::string_view::npos) return text;
+  buffer.assign(text.substr(0, position));
+  for (; position < text.size(); ++position) {
+    const char character = text[position];
+    if (character == '+') {
+      buffer.push_back(' ');
+      continue;
+    }
+    if (character != '%') {
+      buffer.push_back(character);
+      continue;
+    }
+    const int high = position + 2 < text.size()
+                     ? detail::hexValue(text[position + 1])
+                     : -1;
+    const int low = high < 0 ? -1 : detail::hexValue(text[position + 2]);
+    if (low < 0) {
+      return std::unexpected(ParsingError(
+        "Malformed escape sequence in the query string!",
+        ErrorCode::kInvalidArguments
+      ));
+    }
+    buffer.push_back(static_cast<char>(high * 16 + low));
+    position += 2;
+  }
+  return buffer;
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,162 @@
+/**
+ * @file record_stream.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the functions that read the
+ * values of a compound option from a stream.
+ *
+ */
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#if __has_include(<unistd.h>)
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define INPUT_PARSER_HAS_POSIX_STREAMS
+#endif
+
+#include <input_parser/config.hpp>
+#include <input_parser/record_stream.hpp>
+
+namespace input_parser {
+
+namespace detail {
+
+// The amount of bytes requested on every read from a stream
+constexpr std::size_t kStreamReadSize = std::size_t {1} << 20;
+
+/** @brief Adds a record to the list, unless it is empty */
+INPUT_PARSER_INLINE Result<> addRecord(
+  const std::string_view record, StringList &records,
+  const ParseLimits &limits
+) {
+  if (record.empty()) return {};
+  if (record.size() > limits.max_argument_length) {
+    return std::unexpected(
+      ParsingError("An argument is too long!", ErrorCode::kLimitExceeded)
+    );
+  }
+  if (records.size() == limits.max_compound_values) {
+    return std::unexpected(ParsingError(
+      "Too many values provided in the stream!", ErrorCode::kLimitExceeded
+    ));
+  }
+  records.push_back(record);
+  return {};
+}
+
+/**
+ * @brief Adds every record ended inside a chunk of the stream.
+ *
+ * @return The characters after the last delimiter, which may be the start of
+ * a record that continues in the next chunk.
+ */
+INPUT_PARSER_INLINE Result<std::string_view> splitRecords(
+  std::string_view chunk, const char delimiter, StringList &records,
+  const ParseLimits &limits
+) {
+  while (const auto *end = static_cast<const char *>(
+           std::memchr(chunk.data(), delimiter, chunk.size())
+         )) {
+    const auto size = static_cast<std::size_t>(end - chunk.data());
+    if (auto result = addRecord(chunk.substr(0, size), records, limits);
+        !result) {
+      return std::unexpected(result.error());
+    }
+    chunk.remove_prefix(size + 1);
+  }
+  if (chunk.size() > limits.max_argument_length) {
+    return std::unexpected(
+      ParsingError("An argument is too long!", ErrorCode::kLimitExceeded)
+    );
+  }
+  return chunk;
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE std::optional<int> streamDescriptor(
+  const std::string_view source
+) {
+  if (source == "-") return 0;
+  if (!source.starts_with("fd:")) return std::nullopt;
+  int descriptor = 0;
+  const auto *end = source.data() + source.size();
+  const auto [last, error] =
+    std::from_chars(source.data() + 3, end, descriptor);
+  if (error != std::errc() || last != end || descriptor < 0) {
+    return std::nullopt;
+  }
+  return descriptor;
+}
+
+INPUT_PARSER_INLINE Result<> readRecords(
+  const int descriptor, const char delimiter, StringList &records,
+  const ParseLimits &limits
+) {
+#ifdef INPUT_PARSER_HAS_POSIX_STREAMS
+  // A regular file read from its start is mapped and split in place
+  struct stat status {};
+  if (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) &&
+      status.st_size > 0 && lseek(descriptor, 0, SEEK_CUR) == 0) {
+    const auto size = static_cast<std::size_t>(status.st_size);
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapped != MAP_FAILED) {
+      madvise(mapped, size, MADV_SEQUENTIAL);
+      records.reserve(records.size(), records.characters().size() + size);
+      const auto rest = detail::splitRecords(
+        std::string_view(static_cast<const char *>(mapped), size), delimiter,
+        records, limits
+      );
+      auto result = rest ? detail::addRecord(*rest, records, limits)
+                         : std::unexpected(rest.error());
+      munmap(mapped, size);
+      if (result) lseek(descriptor, 0, SEEK_END);
+      return result;
+    }
+  }
+  std::string buffer(detail::kStreamReadSize, '\0');
+  // The characters of the record that continues in the next read
+  std::size_t pending = 0;
+  while (true) {
+    if (pending == buffer.size()) buffer.resize(buffer.size() * 2);
+    const auto bytes =
+      read(descriptor, buffer.data() + pending, buffer.size() - pending);
+    if (bytes < 0 && errno == EINTR) continue;
+    if (bytes < 0) {
+      return std::unexpected(ParsingError(
+        "The values could not be read from the stream!",
+        ErrorCode::kInvalidArguments
+      ));
+    }
+    if (bytes == 0) break;
+    const auto rest = detail::splitRecords(
+      std::string_view(buffer.data(), pending + bytes), delimiter, records,
+      limits
+    );
+    if (!rest) return std::unexpected(rest.error());
+    pending = rest->size();
+    std::memmove(buffer.data(), rest->data(), pending);
+  }
+  return detail::addRecord(
+    std::string_view(buffer.data(), pending), records, limits
+  );
+#else
+  return std::unexpected(ParsingError(
+    "The values can not be read from streams on this platform!",
+    ErrorCode::kInvalidArguments
+  ));
+#endif
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,67 @@
+/**
+ * @file string_interner.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the string interner.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+#include <input_parser/config.hpp>
+#include <input_parser/string_interner.hpp>
+
+namespace input_parser {
+
+INPUT_PARSER_INLINE InternedString
+StringInterner::intern(const std::string_view value) {
+  const auto shard_index =
+    static_cast<std::uint32_t>(StringHash {}(value) % kShards);
+  auto &shard = shards_[shard_index];
+  const std::lock_guard lock(shard.mutex);
+  if (const auto found = shard.ids.find(value); found != shard.ids.end()) {
+    return {found->first, this, found->second * kShards + shard_index};
+  }
+  auto *characters = static_cast<char *>(shard.arena.allocate(value.size(), 1));
+  std::ranges::copy(value, characters);
+  const auto stored = std::string_view(characters, value.size());
+  const auto position = static_cast<std::uint32_t>(shard.strings.size());
+  shard.ids.emplace(stored, position);
+  shard.strings.push_back(stored);
+  shard.characters += value.size();
+  return {stored, this, position * kShards + shard_index};
+}
+
+INPUT_PARSER_INLINE std::string_view
+StringInterner::view(const std::uint32_t id) const {
+  const auto &shard = shards_[id % kShards];
+  const std::lock_guard lock(shard.mutex);
+  return shard.strings[id / kShards];
+}
+
+INPUT_PARSER_INLINE std::size_t StringInterner::size() const {
+  std::size_t amount = 0;
+  for (const auto &shard : shards_) {
+    const std::lock_guard lock(shard.mutex);
+    amount += shard.strings.size();
+  }
+  return amount;
+}
+
+INPUT_PARSER_INLINE std::size_t StringInterner::characters() const {
+  std::size_t amount = 0;
+  for (const auto &shard : shards_) {
+    const std::lock_guard lock(shard.mutex);
+    amount += shard.characters;
+  }
+  return amount;
+}
+
+}  // namespace input_parser
\ No newline at end of file
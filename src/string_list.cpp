@@ -0,0 +1,47 @@
+/**
+ * @file string_list.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the compact list of strings
+ * used to store the values of the compound options.
+ *
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <input_parser/config.hpp>
+#include <input_parser/string_list.hpp>
+
+namespace input_parser {
+
+INPUT_PARSER_INLINE StringList::StringList(
+  const std::vector<std::string> &values
+) {
+  size_type characters = 0;
+  for (const auto &value : values) characters += value.size();
+  reserve(values.size(), characters);
+  for (const auto &value : values) push_back(value);
+}
+
+INPUT_PARSER_INLINE void StringList::reserve(
+  const size_type count, const size_type characters
+) {
+  ends_.reserve(count);
+  characters_.reserve(characters);
+}
+
+INPUT_PARSER_INLINE void StringList::push_back(const std::string_view value) {
+  characters_.append(value);
+  ends_.push_back(characters_.size());
+}
+
+INPUT_PARSER_INLINE std::vector<std::string> StringList::toVector() const {
+  return std::vector<std::string>(begin(), end());
+}
+
+}  // namespace input_parser
\ No newline at end of file
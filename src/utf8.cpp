@@ -0,0 +1,223 @@
+/**
+ * @file utf8.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the UTF-8 validation of the
+ * values of the options.
+ *
+ */
+
+#include <any>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include <input_parser/config.hpp>
+#include <input_parser/string_interner.hpp>
+#include <input_parser/string_list.hpp>
+#include <input_parser/utf8.hpp>
+
+// The AVX2 scan is compiled for every x86 processor and only used by the
+// ones that support it
+#if (defined(__x86_64__) || defined(__i386__)) && \
+  (defined(__GNUC__) || defined(__clang__))
+#define INPUT_PARSER_HAS_AVX2_DISPATCH
+#endif
+
+namespace input_parser {
+
+namespace detail {
+
+#ifdef INPUT_PARSER_HAS_AVX2_DISPATCH
+/** @brief Skips the ASCII characters 32 at a time, returning the position */
+[[gnu::target("avx2")]] INPUT_PARSER_INLINE std::size_t
+skipAsciiAvx2(const char *data, const std::size_t size, std::size_t index) {
+  for (; index + 32 <= size; index += 32) {
+    const auto chunk =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+    // The mask has the highest bit of every byte, only set for non-ASCII
+    const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(chunk));
+    if (mask != 0) {
+      return index + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  return index;
+}
+
+/** @brief Checks once if the processor supports AVX2 */
+INPUT_PARSER_INLINE bool hasAvx2() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+#endif
+
+/** @brief Gets the position of the first non-ASCII character (or the end) */
+INPUT_PARSER_INLINE std::size_t skipAscii(
+  const std::string_view text, std::size_t index
+) {
+  const char *data = text.data();
+  const auto size = text.size();
+#ifdef INPUT_PARSER_HAS_AVX2_DISPATCH
+  if (size - index >= 32 && hasAvx2()) {
+    index = skipAsciiAvx2(data, size, index);
+    if (index < size && static_cast<unsigned char>(data[index]) >= 0x80) {
+      return index;
+    }
+  }
+#endif
+#if defined(__SSE2__)
+  for (; index + 16 <= size; index += 16) {
+    const auto chunk =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index));
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(chunk));
+    if (mask != 0) {
+      return index + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+#endif
+  constexpr std::uint64_t kHighBits = 0x8080808080808080;
+  for (; index + 8 <= size; index += 8) {
+    std::uint64_t word;
+    std::memcpy(&word, data + index, sizeof(word));
+    if ((word & kHighBits) == 0) continue;
+    if constexpr (std::endian::native == std::endian::little) {
+      return index + std::countr_zero(word & kHighBits) / 8;
+    }
+    break;
+  }
+  while (index < size && static_cast<unsigned char>(data[index]) < 0x80) {
+    ++index;
+  }
+  return index;
+}
+
+/**
+ * @brief Gets the length of the multi-byte sequence that starts at the
+ * position provided, or 0 if it is invalid (see RFC 3629, section 4).
+ */
+INPUT_PARSER_INLINE std::size_t sequenceLength(
+  const std::string_view text, const std::size_t index
+) {
+  const auto byte = [&](const std::size_t position) -> unsigned int {
+    if (position >= text.size()) return 0;
+    return static_cast<unsigned char>(text[position]);
+  };
+  const auto continues = [&](
+                           const std::size_t position, const unsigned int low,
+                           const unsigned int high
+                         ) {
+    return byte(position) >= low && byte(position) <= high;
+  };
+  const auto lead = byte(index);
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    return continues(index + 1, 0x80, 0xBF) ? 2 : 0;
+  }
+  if (lead >= 0xE0 && lead <= 0xEF) {
+    // Rejects the overlong sequences and the surrogates
+    const auto low = lead == 0xE0 ? 0xA0U : 0x80U;
+    const auto high = lead == 0xED ? 0x9FU : 0xBFU;
+    return continues(index + 1, low, high) && continues(index + 2, 0x80, 0xBF)
+           ? 3
+           : 0;
+  }
+  if (lead >= 0xF0 && lead <= 0xF4) {
+    // Rejects the overlong sequences and the code points above U+10FFFF
+    const auto low = lead == 0xF0 ? 0x90U : 0x80U;
+    const auto high = lead == 0xF4 ? 0x8FU : 0xBFU;
+    return continues(index + 1, low, high) &&
+               continues(index + 2, 0x80, 0xBF) &&
+               continues(index + 3, 0x80, 0xBF)
+           ? 4
+           : 0;
+  }
+  return 0;
+}
+
+/** @brief Checks if a byte continues a multi-byte sequence */
+INPUT_PARSER_INLINE bool isContinuation(const char byte) {
+  return (static_cast<unsigned char>(byte) & 0xC0) == 0x80;
+}
+
+/** @brief Searches the first invalid sequence of the values of a list */
+INPUT_PARSER_INLINE std::optional<Utf8Error> findInvalidInList(
+  const StringList &values
+) {
+  // All the characters are validated at once. A sequence split between two
+  // values passes, but then the second value starts with a continuation
+  const auto invalid = findInvalidUtf8(values.characters());
+  std::size_t begin = 0;
+  // The last value with characters
+  std::optional<std::size_t> previous;
+  for (std::size_t index = 0; index < values.size(); ++index) {
+    const auto value = values[index];
+    if (previous && !value.empty() && isContinuation(value.front()) &&
+        (!invalid || *invalid > begin)) {
+      const auto truncated = values[*previous];
+      return Utf8Error {*previous, *findInvalidUtf8(truncated)};
+    }
+    if (invalid && *invalid < begin + value.size()) {
+      return Utf8Error {index, *invalid - begin};
+    }
+    if (!value.empty()) previous = index;
+    begin += value.size();
+  }
+  return std::nullopt;
+}
+
+}  // namespace detail
+
+INPUT_PARSER_INLINE std::optional<std::size_t> findInvalidUtf8(
+  const std::string_view text
+) {
+  std::size_t index = 0;
+  while (true) {
+    index = detail::skipAscii(text, index);
+    if (index == text.size()) return std::nullopt;
+    // The multi-byte sequences are decoded until the next ASCII character
+    while (index < text.size() &&
+           static_cast<unsigned char>(text[index]) >= 0x80) {
+      const auto length = detail::sequenceLength(text, index);
+      if (length == 0) return index;
+      index += length;
+    }
+  }
+}
+
+INPUT_PARSER_INLINE std::optional<Utf8Error> findInvalidUtf8Value(
+  const std::any &value
+) {
+  const auto single = [](const std::string_view text) {
+    const auto offset = findInvalidUtf8(text);
+    return offset ? std::optional(Utf8Error {0, *offset}) : std::nullopt;
+  };
+  if (const auto *text = std::any_cast<std::string>(&value)) {
+    return single(*text);
+  }
+  if (const auto *interned = std::any_cast<InternedString>(&value)) {
+    return single(interned->view());
+  }
+  if (const auto *list = std::any_cast<StringList>(&value)) {
+    return detail::findInvalidInList(*list);
+  }
+  if (const auto *texts = std::any_cast<std::vector<std::string>>(&value)) {
+    for (std::size_t index = 0; index < texts->size(); ++index) {
+      if (const auto offset = findInvalidUtf8((*texts)[index])) {
+        return Utf8Error {index, *offset};
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace input_parser
\ No newline at end of file
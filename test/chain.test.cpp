@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/chain.hpp>
+#include <input_parser/parser.hpp>
+
+#include "no_exceptions.hpp"
+
+namespace input_parser {
+
+// Stages shared by the tests
+const auto toNumber = [](const std::string &value) { return std::stoi(value); };
+const auto clamp = [](const int value) { return std::clamp(value, 0, 10); };
+const auto lookup = [](const int value) {
+  return std::string(static_cast<std::size_t>(value), '*');
+};
+
+// --------------------------------- Chain --------------------------------- //
+
+TEST(Chain_then, ShouldApplyTheStagesInOrder) {
+  const auto transformation = chain(toNumber).then(clamp).then(lookup);
+  EXPECT_EQ(transformation(std::string("3")), "***");
+  EXPECT_EQ(transformation(std::string("25")), "**********");
+  EXPECT_EQ(transformation(std::string("-4")), "");
+}
+
+TEST(Chain_then, ShouldKeepTheTypeOfEveryStage) {
+  const auto transformation = chain(toNumber).then(clamp);
+  static_assert(std::same_as<decltype(transformation(std::string())), int>);
+}
+
+TEST(Chain_then, ShouldBeUsableAtCompileTime) {
+  constexpr auto transformation =
+    chain([](const int value) { return value * 2; }).then([](const int value) {
+      return value + 1;
+    });
+  static_assert(transformation(20) == 41);
+}
+
+// -------------------------------- Options -------------------------------- //
+
+TEST(SingleOption_to, ShouldStoreTheResultOfTheChain) {
+  auto parser = Parser().addOption([] {
+    return SingleOption("-s", "--stars")
+      .to(chain(toNumber).then(clamp).then(lookup));
+  });
+  const char *argv[] = {"test", "-s", "12"};
+  parser.parse(3, (char **)argv);
+  EXPECT_EQ(parser.getValue<std::string>("-s"), "**********");
+}
+
+TEST(SingleOption_to, ShouldCheckTheConstraintsOnTheResult) {
+  auto parser = Parser().addOption([] {
+    return SingleOption("-n")
+      .to(chain(toNumber).then(clamp))
+      .transformBeforeCheck()
+      .addConstraint<int>([](const int &value) { return value < 10; }, "");
+  });
+  const char *argv[] = {"test", "-n", "40"};
+  const auto result = parser.tryParse(3, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+}
+
+TEST(CompoundOption_elementsTo, ShouldApplyTheChainToEveryElement) {
+  auto parser = Parser().addOption([] {
+    return CompoundOption("-n").elementsTo(chain(toNumber).then(clamp));
+  });
+  const char *argv[] = {"test", "-n", "4", "-2", "30"};
+  parser.parse(5, (char **)argv);
+  EXPECT_THAT(
+    parser.getValue<std::vector<int>>("-n"), ::testing::ElementsAre(4, 0, 10)
+  );
+}
+
+TEST(CompoundOption_to, ShouldGiveTheChainAllTheElements) {
+  auto parser = Parser().addOption([] {
+    return CompoundOption("-n").to(
+      chain([](const std::vector<std::string> &values) {
+        return values.size();
+      }).then([](const std::size_t size) { return size * 2; })
+    );
+  });
+  const char *argv[] = {"test", "-n", "a", "b", "c"};
+  parser.parse(5, (char **)argv);
+  EXPECT_EQ(parser.getValue<std::size_t>("-n"), 6);
+}
+
+TEST(FlagOption_to, ShouldStoreTheResultOfTheChain) {
+  auto parser = Parser().addOption([] {
+    return FlagOption("-f")
+      .addDefaultValue(false)
+      .to(chain([](const bool value) { return value ? 1 : 0; })
+            .then([](const int value) { return value + 10; }));
+  });
+  const char *argv[] = {"test", "-f"};
+  parser.parse(2, (char **)argv);
+  EXPECT_EQ(parser.getValue<int>("-f"), 11);
+}
+
+}  // namespace input_parser
\ No newline at end of file
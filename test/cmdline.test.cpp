@@ -0,0 +1,33 @@
+#include <string>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <input_parser/cmdline.hpp>
+
+namespace input_parser {
+
+TEST(readCmdline, ShouldReadTheCurrentProcess) {
+  std::string buffer;
+  const auto cmdline = readCmdline(buffer);
+  ASSERT_TRUE(cmdline.has_value());
+  EXPECT_FALSE(cmdline->empty());
+  EXPECT_EQ(readCmdline(getpid(), buffer), *cmdline);
+}
+
+TEST(readCmdline, ShouldReuseTheBuffer) {
+  std::string buffer;
+  ASSERT_TRUE(readCmdline(buffer).has_value());
+  const auto *data = buffer.data();
+  ASSERT_TRUE(readCmdline(getpid(), buffer).has_value());
+  EXPECT_EQ(buffer.data(), data);
+}
+
+TEST(readCmdline, ShouldFailForMissingProcesses) {
+  std::string buffer;
+  const auto cmdline = readCmdline(-1, buffer);
+  ASSERT_FALSE(cmdline.has_value());
+  EXPECT_EQ(cmdline.error().code(), ErrorCode::kInvalidArguments);
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include <input_parser/constraint.hpp>
 
+#include "no_exceptions.hpp"
+
 namespace input_parser {
 
 TEST(Constraint_constructor, ShouldReceiveCallbackAndMessage) {
@@ -39,6 +41,38 @@ TEST(Constraint_call, ShouldReceiveAValueAndUseIt) {
   EXPECT_FALSE(constraint.call(999'999));
 }
 
+TEST(Constraint_measuredCall, ShouldCountCallsAndFailures) {
+  const auto isEven = [](const std::any &value) {
+    return std::any_cast<int>(value) % 2 == 0;
+  };
+  const auto constraint = Constraint(isEven, "The value must be even");
+  EXPECT_TRUE(constraint.measuredCall(2));
+  EXPECT_FALSE(constraint.measuredCall(3));
+  EXPECT_FALSE(constraint.measuredCall(5));
+  // Plain calls are not counted
+  EXPECT_FALSE(constraint.call(7));
+  EXPECT_EQ(constraint.getCalls(), 3);
+  EXPECT_EQ(constraint.getFailures(), 2);
+}
+
+TEST(Constraint_rejectionCost, ShouldUseTheHintBeforeMeasuring) {
+  auto constraint = Constraint([](const std::any &) { return true; }, "");
+  constraint.setCostHint(10);
+  EXPECT_DOUBLE_EQ(constraint.getCostHint(), 10);
+  // Without calls, the constraint is expected to fail half of the times
+  EXPECT_DOUBLE_EQ(constraint.rejectionCost(), 20);
+}
+
+TEST(Constraint_rejectionCost, ShouldGrowWhileTheConstraintDoesNotFail) {
+  const auto constraint =
+    Constraint([](const std::any &) { return true; }, "");
+  constraint.measuredCall(0);
+  const auto cost = constraint.rejectionCost();
+  for (int index = 0; index < 100; ++index) constraint.measuredCall(0);
+  EXPECT_GT(constraint.rejectionCost(), cost);
+}
+
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Constraint_call, ShouldBeAbleToThrowExceptions) {
   const auto callback = [](const std::any &) -> bool {
     throw std::runtime_error("Error");
@@ -47,5 +81,6 @@ TEST(Constraint_call, ShouldBeAbleToThrowExceptions) {
   const auto constraint = Constraint(callback, message);
   EXPECT_THROW(constraint.call(0), std::runtime_error);
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
 }  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/constraint_cache.hpp>
+#include <input_parser/parser.hpp>
+
+#include "no_exceptions.hpp"
+
+namespace input_parser {
+
+// --------------------------------- Cache --------------------------------- //
+
+TEST(ConstraintCache_find, ShouldMissTheValuesNotStored) {
+  const auto cache = ConstraintCache(16);
+  EXPECT_FALSE(cache.find(1, 3, 3).has_value());
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(cache.hits(), 0);
+}
+
+TEST(ConstraintCache_find, ShouldGiveTheResultStored) {
+  auto cache = ConstraintCache(16);
+  cache.store(1, 3, 3, true);
+  cache.store(1, 4, 4, false);
+  EXPECT_EQ(cache.find(1, 3, 3), true);
+  EXPECT_EQ(cache.find(1, 4, 4), false);
+  EXPECT_EQ(cache.hits(), 2);
+}
+
+TEST(ConstraintCache_find, ShouldNotMistakeValuesWithTheSameHash) {
+  auto cache = ConstraintCache(1);
+  cache.store(1, 0, std::string("a"), true);
+  EXPECT_FALSE(cache.find(1, 0, std::string("b")).has_value());
+  EXPECT_FALSE(cache.find(1, 0, 0).has_value());
+  EXPECT_FALSE(cache.find(2, 0, std::string("a")).has_value());
+  EXPECT_EQ(cache.find(1, 0, std::string("a")), true);
+}
+
+TEST(ConstraintCache_addConstraint, ShouldNeverRepeatAnId) {
+  auto cache = ConstraintCache(16);
+  const auto first = cache.addConstraint();
+  EXPECT_NE(first, 0);
+  EXPECT_NE(cache.addConstraint(), first);
+}
+
+TEST(ConstraintCache_store, ShouldKeepAtMostItsCapacity) {
+  auto cache = ConstraintCache(8);
+  for (std::size_t hash = 0; hash < 100; ++hash) {
+    cache.store(1, hash, hash, true);
+  }
+  std::size_t stored = 0;
+  for (std::size_t hash = 0; hash < 100; ++hash) {
+    stored += cache.find(1, hash, hash).has_value() ? 1 : 0;
+  }
+  EXPECT_LE(stored, cache.capacity());
+}
+
+TEST(ConstraintCache_clear, ShouldForgetEverything) {
+  auto cache = ConstraintCache(16);
+  cache.store(1, 3, 3, true);
+  EXPECT_TRUE(cache.find(1, 3, 3).has_value());
+  cache.clear();
+  EXPECT_EQ(cache.hits(), 0);
+  EXPECT_FALSE(cache.find(1, 3, 3).has_value());
+}
+
+// -------------------------------- Options -------------------------------- //
+
+TEST(BaseOption_addConstraint, ShouldOnlyCallPureConstraintsOncePerValue) {
+  auto cache = std::make_shared<ConstraintCache>();
+  auto calls = std::make_shared<int>(0);
+  const auto prototype = Parser().addOption([&] {
+    return SingleOption("-d", "--dataset")
+      .addConstraint<std::string>(
+        [calls](const std::string &value) {
+          ++*calls;
+          return value != "broken";
+        },
+        "Unknown dataset", cache
+      );
+  });
+  // The copies of the parser share the results of the constraint
+  for (const auto *dataset : {"train", "test", "train", "train", "test"}) {
+    auto parser = prototype;
+    const char *argv[] = {"program", "-d", dataset};
+    EXPECT_TRUE(parser.tryParse(3, (char **)argv).has_value());
+  }
+  EXPECT_EQ(*calls, 2);
+  EXPECT_EQ(cache->hits(), 3);
+  EXPECT_EQ(cache->misses(), 2);
+}
+
+TEST(BaseOption_addConstraint, ShouldRememberTheFailures) {
+  auto cache = std::make_shared<ConstraintCache>();
+  auto parser = Parser().addOption([&] {
+    return SingleOption("-n").toInt().transformBeforeCheck().addConstraint<int>(
+      [](const int &value) { return value > 0; }, "Must be positive", cache
+    );
+  });
+  const char *argv[] = {"program", "-n", "-4"};
+  for (int repetition = 0; repetition < 2; ++repetition) {
+    const auto result = parser.tryParse(3, (char **)argv);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_STREQ(result.error().what(), "Must be positive");
+  }
+  EXPECT_EQ(cache->hits(), 1);
+}
+
+TEST(BaseOption_addConstraint, ShouldKeepTheResultsOfEveryConstraintApart) {
+  auto cache = std::make_shared<ConstraintCache>();
+  auto option =
+    SingleOption("-n")
+      .toInt()
+      .transformBeforeCheck()
+      .addConstraint<int>([](const int &value) { return value > 0; }, "", cache)
+      .addConstraint<int>(
+        [](const int &value) { return value % 2 == 0; }, "Must be even", cache
+      )
+      .addConstraint<int>(
+        [](const int &value) { return value < 10; }, "Too big", cache
+      );
+  for (int repetition = 0; repetition < 2; ++repetition) {
+    const auto odd = option.trySetValue(std::string("3"));
+    ASSERT_FALSE(odd.has_value());
+    EXPECT_STREQ(odd.error().what(), "Must be even");
+    const auto big = option.trySetValue(std::string("12"));
+    ASSERT_FALSE(big.has_value());
+    EXPECT_STREQ(big.error().what(), "Too big");
+  }
+  EXPECT_TRUE(option.trySetValue(std::string("4")).has_value());
+}
+
+namespace {
+
+bool isShort(const std::string &value) {
+  return value.size() < 4;
+}
+
+bool hasNoSpace(const std::string &value) {
+  return !value.contains(' ');
+}
+
+}  // namespace
+
+TEST(BaseOption_addConstraint, ShouldTellApartConstraintsOfTheSameType) {
+  auto cache = std::make_shared<ConstraintCache>();
+  auto first = SingleOption("-a").addConstraint<std::string>(
+    isShort, "bad", cache
+  );
+  auto second = SingleOption("-b").addConstraint<std::string>(
+    hasNoSpace, "bad", cache
+  );
+  EXPECT_FALSE(first.trySetValue(std::string("abcdef")).has_value());
+  EXPECT_TRUE(second.trySetValue(std::string("abcdef")).has_value());
+  EXPECT_FALSE(second.trySetValue(std::string("a b")).has_value());
+  EXPECT_TRUE(first.trySetValue(std::string("a b")).has_value());
+}
+
+TEST(BaseOption_addConstraint, ShouldShareTheCacheAmongThreads) {
+  auto cache = std::make_shared<ConstraintCache>();
+  const auto isEven = [](const int &value) { return value % 2 == 0; };
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < 4; ++thread) {
+    threads.emplace_back([&cache, &isEven] {
+      auto option = SingleOption("-n").toInt().transformBeforeCheck();
+      option.addConstraint<int>(isEven, "", cache);
+      for (int value = 0; value < 1000; ++value) {
+        const auto result = option.trySetValue(std::to_string(value % 10));
+        EXPECT_EQ(result.has_value(), value % 2 == 0);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(cache->hits() + cache->misses(), 4000);
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <input_parser/enum_mask.hpp>
+#include <input_parser/option/compound_option.hpp>
+#include <input_parser/string_list.hpp>
+
+#include "no_exceptions.hpp"
+
+namespace input_parser {
+
+enum class Feature { kFast, kSafe, kSmall = 63 };
+
+TEST(EnumMask_set, ShouldChangeASingleElement) {
+  auto mask = EnumMask<Feature>();
+  EXPECT_TRUE(mask.empty());
+  mask.set(Feature::kSmall);
+  EXPECT_TRUE(mask.contains(Feature::kSmall));
+  EXPECT_FALSE(mask.contains(Feature::kFast));
+  EXPECT_EQ(mask.bits(), std::uint64_t {1} << 63);
+  mask.set(Feature::kSmall, false);
+  EXPECT_TRUE(mask.empty());
+}
+
+TEST(EnumMask_containsAll, ShouldCompareWholeMasks) {
+  const EnumMask<Feature> mask = {Feature::kFast, Feature::kSafe};
+  EXPECT_EQ(mask.count(), 2);
+  EXPECT_TRUE(mask.containsAll({Feature::kFast, Feature::kSafe}));
+  EXPECT_FALSE(mask.containsAll({Feature::kFast, Feature::kSmall}));
+  EXPECT_TRUE(mask.containsAny({Feature::kSafe, Feature::kSmall}));
+  EXPECT_EQ(mask & EnumMask<Feature> {Feature::kSafe}, EnumMask<Feature>(2));
+}
+
+TEST(EnumNames_find, ShouldFindEveryName) {
+  std::vector<std::pair<std::string, std::size_t>> elements;
+  for (std::size_t bit = 0; bit < 64; ++bit) {
+    elements.emplace_back("feature-" + std::to_string(bit), bit);
+  }
+  const auto names = EnumNames(elements);
+  EXPECT_EQ(names.size(), 64);
+  for (const auto &[name, bit] : elements) EXPECT_EQ(names.find(name), bit);
+  EXPECT_EQ(names.find("feature-64"), std::nullopt);
+  EXPECT_EQ(names.find(""), std::nullopt);
+}
+
+TEST(EnumNames_constructor, ShouldRejectRepeatedNames) {
+  EXPECT_THROW(EnumNames({{"a", 0}, {"a", 1}}), ParsingError);
+  EXPECT_THROW(EnumNames({{"a", 64}}), ParsingError);
+}
+
+TEST(EnumNames_decode, ShouldSplitTheValues) {
+  const auto names = EnumNames({{"a", 0}, {"b", 1}, {"c", 2}});
+  const auto decoding = names.decode(StringList({"a,c", "b"}), ',');
+  EXPECT_TRUE(decoding.valid);
+  EXPECT_EQ(decoding.bits, 0b111);
+  EXPECT_FALSE(names.decode(StringList({"a,d"}), ',').valid);
+  EXPECT_FALSE(names.decode(StringList({"a", "a"}), ',').valid);
+  EXPECT_FALSE(names.decode(StringList({"a,"}), ',').valid);
+}
+
+TEST(CompoundOption_toMask, ShouldDecodeTheElements) {
+  auto option = CompoundOption("--features").toMask<Feature>(
+    {{"fast", Feature::kFast}, {"small", Feature::kSmall}}
+  );
+  ASSERT_TRUE(option.trySetValue(StringList({"small,fast"})).has_value());
+  const auto mask = option.getValue<EnumMask<Feature>>();
+  EXPECT_TRUE(mask.contains(Feature::kFast));
+  EXPECT_TRUE(mask.contains(Feature::kSmall));
+  EXPECT_FALSE(mask.contains(Feature::kSafe));
+}
+
+TEST(CompoundOption_toMask, ShouldRejectUnknownAndRepeatedElements) {
+  auto option = CompoundOption("--features").toMask<Feature>(
+    {{"fast", Feature::kFast}, {"safe", Feature::kSafe}}, '+'
+  );
+  EXPECT_TRUE(option.trySetValue(StringList({"fast+safe"})).has_value());
+  for (const auto &values :
+       {StringList({"fast", "slow"}), StringList({"safe", "fast+safe"})}) {
+    const auto result = option.trySetValue(values);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+  }
+}
+
+TEST(CompoundOption_toMask, ShouldCheckTheConstraintsOnTheMask) {
+  auto option =
+    CompoundOption("--features")
+      .toMask<Feature>({{"fast", Feature::kFast}, {"safe", Feature::kSafe}})
+      .transformBeforeCheck()
+      .addConstraint<EnumMask<Feature>>(
+        [](const EnumMask<Feature> &mask) { return mask.count() == 1; },
+        "Only one feature can be chosen"
+      );
+  EXPECT_TRUE(option.trySetValue(StringList({"safe"})).has_value());
+  EXPECT_EQ(
+    option.trySetValue(StringList({"fast", "unknown"})).error().code(),
+    ErrorCode::kConstraintFailed
+  );
+  EXPECT_EQ(
+    option.trySetValue(StringList({"fast,safe"})).error().what(),
+    std::string("Only one feature can be chosen")
+  );
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/flag_set.hpp>
+
+namespace input_parser {
+
+TEST(FlagSet_constructor, ShouldStartWithAllTheBitsUnset) {
+  const auto flags = FlagSet(130);
+  EXPECT_EQ(flags.size(), 130);
+  EXPECT_EQ(flags.count(), 0);
+  EXPECT_TRUE(flags.none());
+  EXPECT_EQ(flags.begin(), flags.end());
+}
+
+TEST(FlagSet_set, ShouldChangeASingleBit) {
+  auto flags = FlagSet(100);
+  flags.set(3);
+  flags.set(64);
+  flags.set(99);
+  flags.set(3, false);
+  EXPECT_FALSE(flags.test(3));
+  EXPECT_TRUE(flags.test(64));
+  EXPECT_TRUE(flags.test(99));
+  EXPECT_EQ(flags.count(), 2);
+}
+
+TEST(FlagSet_resize, ShouldClearTheBitsLeftOut) {
+  auto flags = FlagSet(10);
+  flags.set(9);
+  flags.resize(5);
+  flags.resize(10);
+  EXPECT_FALSE(flags.test(9));
+}
+
+TEST(FlagSet_iterator, ShouldGiveThePositionsOfTheBitsSet) {
+  auto flags = FlagSet(200);
+  for (const auto id : {0, 63, 64, 128, 199}) flags.set(id);
+  EXPECT_THAT(flags, ::testing::ElementsAre(0, 63, 64, 128, 199));
+}
+
+TEST(FlagSet_checks, ShouldTestAGroupOfBits) {
+  auto flags = FlagSet(100);
+  flags.set(1);
+  flags.set(70);
+  auto group = FlagSet(100);
+  group.set(1);
+  group.set(70);
+  EXPECT_TRUE(flags.all(group));
+  EXPECT_TRUE(flags.any(group));
+  group.set(2);
+  EXPECT_FALSE(flags.all(group));
+  EXPECT_TRUE(flags.any(group));
+  EXPECT_FALSE(flags.any(FlagSet(100)));
+}
+
+TEST(FlagSet_operators, ShouldCombineSets) {
+  auto lhs = FlagSet(70);
+  lhs.set(1);
+  lhs.set(65);
+  auto rhs = FlagSet(70);
+  rhs.set(65);
+  rhs.set(66);
+  EXPECT_THAT(lhs & rhs, ::testing::ElementsAre(65));
+  EXPECT_THAT(lhs | rhs, ::testing::ElementsAre(1, 65, 66));
+}
+
+}  // namespace input_parser
\ No newline at end of file
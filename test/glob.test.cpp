@@ -0,0 +1,163 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/glob.hpp>
+
+namespace input_parser {
+
+/** @brief A directory tree created for a test and removed after it */
+class GlobTree : public ::testing::Test {
+ protected:
+  std::string root_;
+
+  void SetUp() override {
+    std::string path =
+      (std::filesystem::temp_directory_path() / "glob_XXXXXX").string();
+    ASSERT_NE(mkdtemp(path.data()), nullptr);
+    root_ = path;
+    for (const auto file :
+         {"a.parquet", "b.txt", ".hidden.parquet", "x/c.parquet",
+          "x/y/d.parquet", "x/.git/e.parquet", "z/f.parquet"}) {
+      touch(file);
+    }
+    std::filesystem::create_directory_symlink(root_ + "/x", root_ + "/link");
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(root_);
+  }
+
+  /** @brief Creates an empty file, along with its directories */
+  void touch(const std::string &file) const {
+    const auto path = std::filesystem::path(root_) / file;
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream {path};
+  }
+
+  /** @brief Expands a pattern relative to the root, without limits */
+  std::vector<std::string>
+  expand(const std::string &pattern, const unsigned int threads = 0) const {
+    StringList matches;
+    EXPECT_TRUE(
+      expandGlob(root_ + "/" + pattern, matches, {}, threads).has_value()
+    );
+    std::vector<std::string> paths;
+    for (const auto match : matches) {
+      paths.emplace_back(match.substr(root_.size() + 1));
+    }
+    return paths;
+  }
+};
+
+TEST(isGlobPattern, ShouldRecognizeTheWildcards) {
+  for (const auto pattern : {"*.txt", "data/file?", "[ab].csv", "**/x"}) {
+    EXPECT_TRUE(isGlobPattern(pattern)) << pattern;
+  }
+  for (const auto value : {"data/file.txt", "\\*.txt", "[unclosed", ""}) {
+    EXPECT_FALSE(isGlobPattern(value)) << value;
+  }
+}
+
+TEST(matchGlob, ShouldMatchTheWildcards) {
+  EXPECT_TRUE(matchGlob("*.parquet", "part-0.parquet"));
+  EXPECT_TRUE(matchGlob("*", ""));
+  EXPECT_TRUE(matchGlob("a*b*c", "aXbYbZc"));
+  EXPECT_TRUE(matchGlob("file?.csv", "file1.csv"));
+  EXPECT_TRUE(matchGlob("[a-c]x", "bx"));
+  EXPECT_TRUE(matchGlob("[!a-c]x", "dx"));
+  EXPECT_TRUE(matchGlob("[]]", "]"));
+  EXPECT_TRUE(matchGlob("\\*", "*"));
+  EXPECT_FALSE(matchGlob("*.parquet", "part.parquet.tmp"));
+  EXPECT_FALSE(matchGlob("file?.csv", "file.csv"));
+  EXPECT_FALSE(matchGlob("[a-c]x", "dx"));
+  EXPECT_FALSE(matchGlob("\\*", "a"));
+}
+
+TEST_F(GlobTree, ShouldExpandRecursivePatternsSorted) {
+  EXPECT_THAT(
+    expand("**/*.parquet"),
+    ::testing::ElementsAre(
+      "a.parquet", "x/c.parquet", "x/y/d.parquet", "z/f.parquet"
+    )
+  );
+  EXPECT_THAT(
+    expand("x/**"),
+    ::testing::ElementsAre("x/c.parquet", "x/y", "x/y/d.parquet")
+  );
+}
+
+TEST_F(GlobTree, ShouldFollowLinksOnlyOutsideRecursivePatterns) {
+  EXPECT_THAT(
+    expand("*/c.parquet"),
+    ::testing::ElementsAre("link/c.parquet", "x/c.parquet")
+  );
+}
+
+TEST_F(GlobTree, ShouldMatchHiddenNamesOnlyWithADot) {
+  EXPECT_THAT(expand("*.parquet"), ::testing::ElementsAre("a.parquet"));
+  EXPECT_THAT(
+    expand(".*.parquet"), ::testing::ElementsAre(".hidden.parquet")
+  );
+  EXPECT_THAT(
+    expand("**/.git/*"), ::testing::ElementsAre("x/.git/e.parquet")
+  );
+}
+
+TEST_F(GlobTree, ShouldKeepThePatternsWithoutMatches) {
+  StringList matches;
+  const auto pattern = root_ + "/**/*.csv";
+  ASSERT_TRUE(expandGlob(pattern, matches, {}).has_value());
+  EXPECT_THAT(matches, ::testing::ElementsAre(pattern));
+}
+
+TEST_F(GlobTree, ShouldExpandManyDirectories) {
+  for (int index = 0; index < 300; ++index) {
+    touch("many/" + std::to_string(index) + "/part.parquet");
+  }
+  // More threads than cores, so several of them list at the same time
+  for (const unsigned int threads : {0U, 1U, 8U}) {
+    const auto paths = expand("many/**/*.parquet", threads);
+    ASSERT_EQ(paths.size(), 300);
+    EXPECT_TRUE(std::ranges::is_sorted(paths));
+    EXPECT_EQ(paths.front(), "many/0/part.parquet");
+  }
+}
+
+TEST_F(GlobTree, ShouldStopEveryThreadOnALimit) {
+  for (int index = 0; index < 300; ++index) {
+    touch("many/" + std::to_string(index) + "/part.parquet");
+  }
+  // The limit is found while the rest of the threads are still listing (and
+  // starting more threads)
+  for (int attempt = 0; attempt < 500; ++attempt) {
+    StringList matches;
+    const auto result = expandGlob(
+      root_ + "/many/**/*.parquet", matches, {.max_compound_values = 1}, 8
+    );
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code(), ErrorCode::kLimitExceeded);
+  }
+}
+
+TEST_F(GlobTree, ShouldEnforceTheLimits) {
+  StringList matches;
+  const auto many = expandGlob(
+    root_ + "/**/*.parquet", matches, {.max_compound_values = 3}
+  );
+  ASSERT_FALSE(many.has_value());
+  EXPECT_EQ(many.error().code(), ErrorCode::kLimitExceeded);
+  const auto pattern = root_ + "/b*";
+  const auto longer = expandGlob(
+    pattern, matches, {.max_argument_length = pattern.size()}
+  );
+  ASSERT_FALSE(longer.has_value());
+  EXPECT_EQ(longer.error().code(), ErrorCode::kLimitExceeded);
+}
+
+}  // namespace input_parser
\ No newline at end of file
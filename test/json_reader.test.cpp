@@ -0,0 +1,85 @@
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <input_parser/json_reader.hpp>
+
+namespace input_parser {
+
+TEST(JsonReader_readScalar, ShouldNotCopyStringsWithoutEscapes) {
+  const std::string_view text = R"("plain text")";
+  std::string buffer;
+  JsonReader reader(text);
+  const auto value = reader.readScalar(buffer);
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(*value, "plain text");
+  EXPECT_EQ(value->data(), text.data() + 1);
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(JsonReader_readScalar, ShouldDecodeEscapeSequences) {
+  std::string buffer;
+  JsonReader reader(R"("a\"b\\c\/d\n\u0041\u00e9\ud83d\ude00")");
+  EXPECT_EQ(reader.readScalar(buffer), "a\"b\\c/d\nA\xC3\xA9\xF0\x9F\x98\x80");
+}
+
+TEST(JsonReader_readScalar, ShouldReadNumbersAndBooleansAsWritten) {
+  std::string buffer;
+  JsonReader reader("[-1.5e+3, 0, true, false]");
+  ASSERT_TRUE(reader.enter('[').has_value());
+  for (const auto expected : {"-1.5e+3", "0", "true", "false"}) {
+    EXPECT_TRUE(reader.nextElement(expected[0] == '-').value());
+    EXPECT_EQ(reader.readScalar(buffer), expected);
+  }
+  EXPECT_FALSE(reader.nextElement(false).value());
+  EXPECT_TRUE(reader.finish().has_value());
+}
+
+TEST(JsonReader_readScalar, ShouldRejectMalformedValues) {
+  std::string buffer;
+  for (const auto text :
+       {"01", "1.", "-", "1e", "tru", "\"open", "\"\\x\"", "\"\\ud800\"",
+        "\"\\udc00\"", "\"\\ud800\\u0041\"", "\"\\u12g4\"", "{}", "null"}) {
+    JsonReader reader(text);
+    const auto value = reader.readScalar(buffer);
+    ASSERT_FALSE(value.has_value()) << text;
+    EXPECT_EQ(value.error().code(), ErrorCode::kInvalidArguments);
+  }
+}
+
+TEST(JsonReader_nextKey, ShouldReadEveryKey) {
+  std::string buffer;
+  JsonReader reader(R"( { "a" : 1 , "b\u0063" : 2 } )");
+  ASSERT_TRUE(reader.enter('{').has_value());
+  EXPECT_EQ(reader.nextKey(true, buffer).value(), "a");
+  EXPECT_TRUE(reader.skip().has_value());
+  EXPECT_EQ(reader.nextKey(false, buffer).value(), "bc");
+  EXPECT_TRUE(reader.skip().has_value());
+  EXPECT_EQ(reader.nextKey(false, buffer).value(), std::nullopt);
+  EXPECT_TRUE(reader.finish().has_value());
+}
+
+TEST(JsonReader_skip, ShouldSkipNestedValues) {
+  JsonReader reader(R"({"a": [1, {"b": "]}\"["}], "c": null} 2)");
+  EXPECT_EQ(reader.peek(), JsonKind::kObject);
+  ASSERT_TRUE(reader.skip().has_value());
+  EXPECT_EQ(reader.peek(), JsonKind::kNumber);
+  ASSERT_TRUE(reader.skip().has_value());
+  EXPECT_TRUE(reader.finish().has_value());
+}
+
+TEST(JsonReader_skip, ShouldRejectUnterminatedValues) {
+  for (const auto text : {R"({"a": [1, 2})", R"(["a)", ""}) {
+    JsonReader reader(text);
+    EXPECT_FALSE(reader.skip().has_value()) << text;
+  }
+}
+
+TEST(JsonReader_skip, ShouldRejectMismatchedBrackets) {
+  for (const auto text : {R"([1, 2})", R"({"a": [1, 2}, "b": 3})", "[{]}"}) {
+    JsonReader reader(text);
+    EXPECT_FALSE(reader.skip().has_value()) << text;
+  }
+}
+
+}  // namespace input_parser
\ No newline at end of file
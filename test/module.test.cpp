@@ -0,0 +1,44 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+import input_parser;
+
+// Only built with INPUT_PARSER_BUILD_MODULE: checks that the entities
+// exported by the module can be used without including any header.
+
+TEST(Module_import, ParsesWithTheExportedParser) {
+  auto parser =
+    input_parser::Parser()
+      .addOption([] { return input_parser::FlagOption("-v"); })
+      .addOption([] { return input_parser::SingleOption("-n").toInt(); })
+      .addOption([] { return input_parser::CompoundOption("-p"); });
+  const char *argv[] = {"test", "-v", "-n", "7", "-p", "a", "b"};
+  const input_parser::Result<> result = parser.tryParse(7, (char **)argv);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(parser.getValue<bool>("-v"));
+  EXPECT_EQ(parser.getValue<int>("-n"), 7);
+  EXPECT_EQ(
+    parser.getValue<std::vector<std::string>>("-p"),
+    std::vector<std::string>({"a", "b"})
+  );
+}
+
+TEST(Module_import, ReportsErrorsWithTheExportedCodes) {
+  auto parser = input_parser::Parser().addOption([] {
+    return input_parser::SingleOption("-n");
+  });
+  const char *argv[] = {"test"};
+  const auto result = parser.tryParse(1, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), input_parser::ErrorCode::kMissingOption);
+}
+
+TEST(Module_import, ExportsTheValueHelpers) {
+  EXPECT_EQ(input_parser::numberCast<int>("42"), 42);
+  EXPECT_TRUE(input_parser::isValidUtf8("caf\xC3\xA9"));
+  EXPECT_TRUE(input_parser::matchGlob("*.csv", "a.csv"));
+  const input_parser::StringList list({"a", "b"});
+  EXPECT_EQ(list.size(), 2);
+}
\ No newline at end of file
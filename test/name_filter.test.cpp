@@ -0,0 +1,63 @@
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/name_filter.hpp>
+
+namespace input_parser {
+
+TEST(NameFilter_constructor, ShouldRejectEveryString) {
+  const auto filter = NameFilter();
+  EXPECT_FALSE(filter.mayContain(""));
+  EXPECT_FALSE(filter.mayContain("-n"));
+}
+
+TEST(NameFilter_mayContain, ShouldAcceptEveryNameAdded) {
+  auto filter = NameFilter();
+  const std::string names[] = {"-n", "--name", "-x", "--a-very-long-name", ""};
+  for (const auto &name : names) filter.add(name);
+  for (const auto &name : names) EXPECT_TRUE(filter.mayContain(name));
+}
+
+TEST(NameFilter_mayContain, ShouldRejectStringsWithOtherFirstCharacter) {
+  auto filter = NameFilter();
+  filter.add("-n");
+  EXPECT_FALSE(filter.mayContain("1n"));
+  EXPECT_FALSE(filter.mayContain("/n"));
+}
+
+TEST(NameFilter_mayContain, ShouldRejectStringsLongerThanEveryName) {
+  auto filter = NameFilter();
+  filter.add("--name");
+  EXPECT_FALSE(filter.mayContain("--names"));
+  EXPECT_FALSE(filter.mayContain(std::string(4096, '-')));
+}
+
+TEST(NameFilter_mayContain, ShouldRejectStringsWithOtherLength) {
+  auto filter = NameFilter();
+  filter.add("-n");
+  filter.add("--name");
+  EXPECT_FALSE(filter.mayContain("--n"));
+}
+
+TEST(NameFilter_mayContain, ShouldRejectMostValues) {
+  auto filter = NameFilter();
+  for (const auto *name : {"-i", "--input", "-o", "--output", "--verbose"}) {
+    filter.add(name);
+  }
+  int accepted = 0;
+  for (int value = 0; value < 1000; ++value) {
+    accepted += filter.mayContain("--" + std::to_string(value)) ? 1 : 0;
+  }
+  EXPECT_LT(accepted, 50);
+}
+
+TEST(NameFilter_clear, ShouldRemoveEveryName) {
+  auto filter = NameFilter();
+  filter.add("-n");
+  filter.clear();
+  EXPECT_FALSE(filter.mayContain("-n"));
+}
+
+}  // namespace input_parser
\ No newline at end of file
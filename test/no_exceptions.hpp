@@ -0,0 +1,23 @@
+#ifndef _INPUT_TEST_NO_EXCEPTIONS_HPP_
+#define _INPUT_TEST_NO_EXCEPTIONS_HPP_
+
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+/**
+ * When the library is built with INPUT_PARSER_NO_EXCEPTIONS the errors abort
+ * the program instead of being thrown, so the assertions about exceptions
+ * become death tests. Tests helpers must use TEST_THROW instead of throw.
+ */
+#ifdef INPUT_PARSER_NO_EXCEPTIONS
+#undef EXPECT_THROW
+#define EXPECT_THROW(statement, exception) EXPECT_DEATH(statement, "")
+#undef EXPECT_NO_THROW
+#define EXPECT_NO_THROW(statement) static_cast<void>(statement)
+#define TEST_THROW(exception) std::abort()
+#else
+#define TEST_THROW(exception) throw exception
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
+
+#endif  // _INPUT_TEST_NO_EXCEPTIONS_HPP_
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include <input_parser/option/base_option.hpp>
 #include <input_parser/parsing_error.hpp>
 
+#include "../no_exceptions.hpp"
+
 namespace input_parser {
 
 /** @brief Mock class since BaseOption has purely virtual methods */
@@ -20,15 +22,28 @@ class MockOption : public BaseOption {
     BaseOption(name, extra_names...) {}
 
   inline BaseOption &toInt() override {
-    throw std::runtime_error("Not implemented");
+    TEST_THROW(std::runtime_error("Not implemented"));
   }
 
   inline BaseOption &toDouble() override {
-    throw std::runtime_error("Not implemented");
+    TEST_THROW(std::runtime_error("Not implemented"));
   }
 
   inline BaseOption &toFloat() override {
-    throw std::runtime_error("Not implemented");
+    TEST_THROW(std::runtime_error("Not implemented"));
+  }
+
+  using BaseOption::validUtf8;
+
+  /** @brief Gives access to the constraints, along with their statistics */
+  inline const std::vector<Constraint> &getConstraints() const {
+    return constraints_;
+  }
+
+  /** @brief Gets the positions of the constraints, in the order checked */
+  inline const std::vector<std::size_t> &getConstraintOrder() const {
+    sortConstraints();
+    return constraint_order_;
   }
 };
 
@@ -234,6 +249,7 @@ TEST(BaseOption_adders, ShouldThrowParsingErrorFailingConstraint) {
   EXPECT_THROW(option.setValue(1), ParsingError);
 }
 
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(BaseOption_adders, ShouldStoreErrorMessageAtParsingError) {
   auto option = MockOption("name");
   const auto isOdd = [](const int &value) { return value % 2 == 1; };
@@ -251,6 +267,7 @@ TEST(BaseOption_adders, ShouldStoreErrorMessageAtParsingError) {
     ParsingError
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
 TEST(BaseOption_adders, ShouldAddConstraintWithStruct) {
   auto option = MockOption("name");
@@ -280,6 +297,72 @@ TEST(BaseOption_adders, ConstraintShouldNotAffectDefaultValue) {
   EXPECT_EQ(option.getDefaultValue<decltype(expected)>(), expected);
 }
 
+// --------------------------- Constraint order --------------------------- //
+
+TEST(BaseOption_orderConstraintsAdaptively, ShouldKeepInsertionOrderByDefault) {
+  auto option = MockOption("name");
+  option.addConstraint<int>([](const int &) { return false; }, "First")
+    .addConstraint<int>([](const int &) { return false; }, "Second")
+    .hintConstraintCost(1);
+  const auto result = option.trySetValue(0);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_STREQ(result.error().what(), "First");
+}
+
+TEST(BaseOption_orderConstraintsAdaptively, ShouldStartWithTheCheapestHint) {
+  auto option = MockOption("name");
+  option.addConstraint<int>([](const int &) { return false; }, "Expensive")
+    .hintConstraintCost(1'000'000)
+    .addConstraint<int>([](const int &) { return false; }, "Cheap")
+    .hintConstraintCost(1)
+    .orderConstraintsAdaptively();
+  const auto result = option.trySetValue(0);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_STREQ(result.error().what(), "Cheap");
+}
+
+TEST(BaseOption_orderConstraintsAdaptively, ShouldCheckFirstTheOneFailing) {
+  auto option = MockOption("name");
+  option.addConstraint<int>([](const int &) { return true; }, "Never fails")
+    .addConstraint<int>([](const int &value) { return value % 2 == 0; }, "Odd")
+    .orderConstraintsAdaptively();
+  for (int index = 0; index < 100; ++index) {
+    EXPECT_FALSE(option.trySetValue(1).has_value());
+  }
+  // The times measured depend on the machine, so only the failures counted
+  // and the order they lead to are checked
+  const auto &constraints = option.getConstraints();
+  EXPECT_EQ(constraints[0].getFailures(), 0);
+  EXPECT_EQ(constraints[1].getFailures(), 100);
+  EXPECT_EQ(constraints[1].getCalls(), 100);
+  const auto &order = option.getConstraintOrder();
+  EXPECT_LE(
+    constraints[order[0]].rejectionCost(), constraints[order[1]].rejectionCost()
+  );
+}
+
+TEST(BaseOption_orderConstraintsAdaptively, ShouldHintTheBuiltInConstraints) {
+  auto option = MockOption("name");
+  option.addConstraint<std::string>(
+    [](const std::string &) { return true; }, "Default"
+  );
+  option.validUtf8();
+  const auto &constraints = option.getConstraints();
+  EXPECT_LT(constraints[1].getCostHint(), constraints[0].getCostHint());
+}
+
+TEST(BaseOption_orderConstraintsAdaptively, ShouldKeepTheErrorOfASingleFail) {
+  auto option = MockOption("name");
+  option.addConstraint<int>([](const int &value) { return value > 0; }, "Sign")
+    .addConstraint<int>([](const int &value) { return value % 2 == 0; }, "Odd")
+    .orderConstraintsAdaptively();
+  for (int index = 0; index < 100; ++index) {
+    const auto result = option.trySetValue(index % 2 == 0 ? -2 : 3);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_STREQ(result.error().what(), index % 2 == 0 ? "Sign" : "Odd");
+  }
+}
+
 // ---------------------------- Transformations ---------------------------- //
 
 TEST(BaseOption_transformation, ShouldNotImplementToInt) {
@@ -1,12 +1,22 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <thread>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #include <input_parser/parser.hpp>
 
+#include "no_exceptions.hpp"
+
 namespace input_parser {
 
 // ------------------------------- AddOption ------------------------------- //
 
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Parser_addOption, ThrowsErrorWithOptionsWithSameName) {
   auto parser = input_parser::Parser();
   EXPECT_NO_THROW(parser.addOption([] {
@@ -26,6 +36,7 @@ TEST(Parser_addOption, ThrowsErrorWithOptionsWithSameName) {
     std::invalid_argument
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
 TEST(Parser_addOption, AddsFlagOption) {
   auto parser = input_parser::Parser().addOption([] {
@@ -97,6 +108,59 @@ TEST(Parser_addHelpOption, AddsHelpOptionWithOtherOptions) {
   EXPECT_NO_THROW(parser.parse(2, (char **)argv));
 }
 
+// ---------------------------- MemoryResource ----------------------------- //
+
+/** @brief Memory resource that counts the allocations it receives */
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t allocations = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment)
+    override {
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other
+  ) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(Parser_memoryResource, UsesTheDefaultResource) {
+  const auto parser = input_parser::Parser();
+  EXPECT_EQ(parser.getMemoryResource(), std::pmr::get_default_resource());
+}
+
+TEST(Parser_memoryResource, AllocatesFromTheResourceProvided) {
+  CountingResource resource;
+  auto parser = input_parser::Parser(&resource);
+  parser.addOption([] { return SingleOption("-s", "--single"); });
+  const auto allocations = resource.allocations;
+  EXPECT_GT(allocations, 0);
+  const char *argv[] = {"test", "--single", "value"};
+  parser.parse(3, (char **)argv);
+  EXPECT_GT(resource.allocations, allocations);
+  EXPECT_EQ(parser.getValue<std::string>("-s"), "value");
+}
+
+TEST(Parser_memoryResource, CopiesKeepTheResource) {
+  std::array<std::byte, 4096> buffer {};
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+  auto parser = input_parser::Parser(&arena).addOption([] {
+    return FlagOption("-f");
+  });
+  EXPECT_EQ(parser.getMemoryResource(), &arena);
+  const char *argv[] = {"test", "-f"};
+  parser.parse(2, (char **)argv);
+  EXPECT_TRUE(parser.getValue<bool>("-f"));
+}
+
 // --------------------------------- Parse --------------------------------- //
 
 TEST(Parser_parse, DoesNotThrowErrorParsingWithoutOptions) {
@@ -105,6 +169,7 @@ TEST(Parser_parse, DoesNotThrowErrorParsingWithoutOptions) {
   EXPECT_NO_THROW(parser.parse(1, (char **)argv));
 }
 
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Parser_parse, ThrowsErrorParsingParametersWithoutOptions) {
   auto parser = input_parser::Parser();
   auto argv = new const char *[2] {"test", "param"};
@@ -120,6 +185,7 @@ TEST(Parser_parse, ThrowsErrorParsingParametersWithoutOptions) {
     input_parser::ParsingError
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
 TEST(Parser_parse, ParsesFlagOption) {
   auto parser = input_parser::Parser().addOption([] {
@@ -169,6 +235,7 @@ TEST(Parser_parse, ParsesSingleOptionAsString) {
   EXPECT_EQ(parser.getValue<std::string>("--single"), expected);
 }
 
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Parser_parse, ThrowsErrorExpectingSingleOptionArgument) {
   auto parser = input_parser::Parser().addOption([] {
     return input_parser::SingleOption("-s", "--single");
@@ -188,6 +255,7 @@ TEST(Parser_parse, ThrowsErrorExpectingSingleOptionArgument) {
     input_parser::ParsingError
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
 TEST(Parser_parse, ParsesCompoundOption) {
   auto parser = input_parser::Parser().addOption([] {
@@ -209,6 +277,50 @@ TEST(Parser_parse, ParsesCompoundOptionAsStringVector) {
   EXPECT_EQ(parser.getValue<decltype(expected)>("--compound"), expected);
 }
 
+TEST(Parser_parse, ParsesCompoundOptionAsStringList) {
+  auto parser = input_parser::Parser().addOption([] {
+    return input_parser::CompoundOption("-c", "--compound");
+  });
+  const char *argv[] = {"test", "--compound", "value1", "value2"};
+  parser.parse(4, (char **)argv);
+  const auto values = parser.getValue<StringList>("-c");
+  EXPECT_EQ(values.characters(), "value1value2");
+  EXPECT_THAT(values, ::testing::ElementsAre("value1", "value2"));
+}
+
+TEST(Parser_parse, TransformsEachElementOfTheCompoundOption) {
+  auto parser = input_parser::Parser().addOption([] {
+    return input_parser::CompoundOption("-n").toInt();
+  });
+  const char *argv[] = {"test", "-n", "1", "-2", "30"};
+  parser.parse(5, (char **)argv);
+  EXPECT_EQ(parser.getValue<std::vector<int>>("-n"), std::vector({1, -2, 30}));
+}
+
+TEST(Parser_parse, ReportsMalformedNumbersAsBadValueTypes) {
+  auto parser =
+    input_parser::Parser()
+      .addOption([] { return SingleOption("-n").toInt(); })
+      .addOption([] { return CompoundOption("-r").toDouble(); });
+  const char *argv[] = {"test", "-n", "+7", "-r", "0.5", "-1e3"};
+  ASSERT_TRUE(parser.tryParse(6, (char **)argv).has_value());
+  EXPECT_EQ(parser.getValue<int>("-n"), 7);
+  EXPECT_EQ(
+    parser.getValue<std::vector<double>>("-r"), std::vector({0.5, -1e3})
+  );
+  for (const auto *value : {"abc", "12abc", "", "99999999999"}) {
+    const char *invalid_argv[] = {"test", "-n", value, "-r", "1"};
+    const auto result = parser.tryParse(5, (char **)invalid_argv);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code(), ErrorCode::kBadValueType);
+  }
+  const char *compound_argv[] = {"test", "-n", "1", "-r", "1", "x"};
+  const auto result = parser.tryParse(6, (char **)compound_argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_STREQ(result.error().what(), "The value is not a valid number");
+}
+
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Parser_parse, ThrowsErrorExpectingCompoundOptionArgument) {
   auto parser = input_parser::Parser().addOption([] {
     return input_parser::CompoundOption("-c", "--compound");
@@ -228,7 +340,9 @@ TEST(Parser_parse, ThrowsErrorExpectingCompoundOptionArgument) {
     input_parser::ParsingError
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Parser_parse, ThrowsErrorExpectingNotProvidedOption) {
   auto parser = input_parser::Parser();
   parser.addOption([] { return input_parser::FlagOption("-v", "--verbose"); }
@@ -246,7 +360,9 @@ TEST(Parser_parse, ThrowsErrorExpectingNotProvidedOption) {
     input_parser::ParsingError
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Parser_parse, ThrowsExceptionParsingAndProvidingHelpOption) {
   auto parser = input_parser::Parser().addHelpOption();
   const char *argv[] = {"test", "-h"};
@@ -262,7 +378,9 @@ TEST(Parser_parse, ThrowsExceptionParsingAndProvidingHelpOption) {
     input_parser::ParsingError
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
 
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
 TEST(Parser_parse, ThrowsHelpOptionWithOtherOptions) {
   auto parser = input_parser::Parser().addHelpOption().addOption([] {
     return input_parser::FlagOption("-v", "--verbose");
@@ -280,5 +398,766 @@ TEST(Parser_parse, ThrowsHelpOptionWithOtherOptions) {
     input_parser::ParsingError
   );
 }
+#endif  // INPUT_PARSER_NO_EXCEPTIONS
+
+// ------------------------------- TryParse -------------------------------- //
+
+TEST(Parser_tryParse, ReturnsNothingWithValidArguments) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("-s");
+  });
+  const char *argv[] = {"test", "-s", "value"};
+  EXPECT_TRUE(parser.tryParse(3, (char **)argv).has_value());
+  EXPECT_EQ(parser.getValue<std::string>("-s"), "value");
+}
+
+TEST(Parser_tryParse, ReturnsTheErrorOfInvalidArguments) {
+  auto parser = input_parser::Parser();
+  const char *argv[] = {"test", "param"};
+  const auto result = parser.tryParse(2, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kInvalidArguments);
+  EXPECT_STREQ(result.error().what(), "Invalid arguments provided!");
+}
+
+TEST(Parser_tryParse, ReturnsTheErrorOfMissingArguments) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("-s"); })
+                  .addOption([] { return CompoundOption("-c"); });
+  const char *single_argv[] = {"test", "-s", "-c", "value"};
+  const auto single = parser.tryParse(4, (char **)single_argv);
+  ASSERT_FALSE(single.has_value());
+  EXPECT_EQ(single.error().code(), ErrorCode::kMissingArgument);
+  const char *compound_argv[] = {"test", "-c"};
+  const auto compound = parser.tryParse(2, (char **)compound_argv);
+  ASSERT_FALSE(compound.has_value());
+  EXPECT_EQ(compound.error().code(), ErrorCode::kMissingArgument);
+}
+
+TEST(Parser_tryParse, ReturnsTheErrorOfMissingOptions) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("-s");
+  });
+  const char *argv[] = {"test"};
+  const auto result = parser.tryParse(1, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kMissingOption);
+  EXPECT_STREQ(result.error().what(), "Missing option -s");
+}
+
+TEST(Parser_tryParse, ReturnsTheErrorOfConstraints) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("-s").addConstraint<std::string>(
+      [](const std::string &value) { return value.size() < 3; }, "Too long"
+    );
+  });
+  const char *argv[] = {"test", "-s", "value"};
+  const auto result = parser.tryParse(3, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+  EXPECT_STREQ(result.error().what(), "Too long");
+}
+
+TEST(Parser_tryParse, ReturnsTheUsageWhenHelpIsRequested) {
+  auto parser = input_parser::Parser().addHelpOption();
+  const char *argv[] = {"test", "--help"};
+  const auto result = parser.tryParse(2, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kHelpRequested);
+  EXPECT_EQ(result.error().what(), parser.usage());
+}
+
+// ------------------------------- Families ------------------------------- //
+
+TEST(Parser_addOptionFamily, ParsesEveryMemberOfTheFamily) {
+  auto parser = input_parser::Parser().addOptionFamily([] {
+    return SingleOption("--log-level-*").toInt();
+  });
+  const char *argv[] = {"test", "--log-level-net", "3", "--log-level-db", "1"};
+  ASSERT_TRUE(parser.tryParse(5, (char **)argv).has_value());
+  const auto &family = parser.getFamily("--log-level-*");
+  EXPECT_EQ(family.size(), 2);
+  EXPECT_THAT(family.getKeys(), ::testing::ElementsAre("db", "net"));
+  EXPECT_EQ(family.getValue<int>("net"), 3);
+  EXPECT_EQ(family.getValue<int>("db"), 1);
+  EXPECT_FALSE(family.contains("disk"));
+}
+
+TEST(Parser_addOptionFamily, PrefersTheOptionsOverTheFamilies) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("--weight.total"); })
+                  .addOptionFamily([] { return SingleOption("--weight.*"); });
+  const char *argv[] = {"test", "--weight.total", "9", "--weight.a", "4"};
+  ASSERT_TRUE(parser.tryParse(5, (char **)argv).has_value());
+  EXPECT_EQ(parser.getValue<std::string>("--weight.total"), "9");
+  const auto &family = parser.getFamily("--weight.*");
+  EXPECT_THAT(family.getKeys(), ::testing::ElementsAre("a"));
+}
+
+TEST(Parser_addOptionFamily, EndsTheValuesOfACompoundOption) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return CompoundOption("-c"); })
+                  .addOptionFamily([] { return SingleOption("-W*"); });
+  const char *argv[] = {"test", "-c", "1", "2", "-Wa", "3"};
+  ASSERT_TRUE(parser.tryParse(6, (char **)argv).has_value());
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("-c"),
+    ::testing::ElementsAre("1", "2")
+  );
+  EXPECT_EQ(parser.getFamily("-W*").getValue<std::string>("a"), "3");
+}
+
+TEST(Parser_addOptionFamily, ChecksTheConstraintsOfThePrototype) {
+  auto parser = input_parser::Parser().addOptionFamily([] {
+    return SingleOption("--weight.*").addConstraint<std::string>(
+      [](const std::string &value) { return value != "0"; }, "Zero weight"
+    );
+  });
+  const char *argv[] = {"test", "--weight.a", "0"};
+  const auto result = parser.tryParse(3, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+}
+
+TEST(Parser_addOptionFamily, ReturnsTheDefaultValueOfMissingMembers) {
+  auto parser = input_parser::Parser().addOptionFamily([] {
+    return SingleOption("--weight.*").addDefaultValue(std::string("1"));
+  });
+  EXPECT_EQ(parser.getFamily("--weight.*").getValue<std::string>("b"), "1");
+}
+
+TEST(Parser_addOptionFamily, RequiresAnExtraArgument) {
+  auto parser = input_parser::Parser().addOptionFamily([] {
+    return SingleOption("--weight.*");
+  });
+  const char *argv[] = {"test", "--weight.a"};
+  const auto result = parser.tryParse(2, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kMissingArgument);
+}
+
+TEST(Parser_addOptionFamily, RaisesAnErrorWithoutAsterisk) {
+  auto parser = input_parser::Parser();
+  EXPECT_THROW(
+    parser.addOptionFamily([] { return SingleOption("--weight"); }),
+    ParsingError
+  );
+}
+
+TEST(Parser_getFamily, RaisesAnErrorRequestingUnknownFamilies) {
+  const auto parser = input_parser::Parser();
+  EXPECT_THROW(parser.getFamily("--weight.*"), ParsingError);
+}
+
+// ------------------------------- Subtrees ------------------------------- //
+
+/** @brief Creates a parser with options named after dotted paths */
+input_parser::Parser makeDottedParser() {
+  return input_parser::Parser()
+    .addOption([] { return SingleOption("--db.pool.size").toInt(); })
+    .addOption([] { return SingleOption("--db.pool.timeout"); })
+    .addOption([] { return SingleOption("--db.pool-old"); })
+    .addOption([] { return SingleOption("--db.primary.host"); })
+    .addOption([] {
+      return FlagOption("-v", "--db.pool").addDefaultValue(false);
+    })
+    .addOption([] { return SingleOption("--threads"); });
+}
+
+TEST(Parser_getSubtree, FindsEveryOptionInsideThePath) {
+  const auto parser = makeDottedParser();
+  const auto pool = parser.getSubtree("db.pool");
+  EXPECT_THAT(
+    std::vector<std::string>(pool.begin(), pool.end()),
+    ::testing::ElementsAre("--db.pool", "--db.pool.size", "--db.pool.timeout")
+  );
+  EXPECT_EQ(parser.getSubtree("db").size(), 5);
+  EXPECT_EQ(parser.getSubtree("").size(), 5);
+  EXPECT_TRUE(parser.getSubtree("db.replica").empty());
+  EXPECT_TRUE(parser.getSubtree("threads").empty());
+}
+
+TEST(Parser_getSubtree, SearchesRelativePaths) {
+  const auto parser = makeDottedParser();
+  const auto pool = parser.getSubtree("db.pool");
+  EXPECT_EQ(pool.find("size"), "--db.pool.size");
+  EXPECT_EQ(pool.find(""), "--db.pool");
+  EXPECT_FALSE(pool.find("host").has_value());
+  EXPECT_FALSE(pool.contains("-old"));
+}
+
+TEST(Parser_getSubtree, GetsTheValuesOfTheOptions) {
+  auto parser = makeDottedParser();
+  const char *argv[] = {
+    "test", "--db.pool.size", "8", "--db.pool.timeout", "3s",
+    "--db.primary.host", "localhost", "--threads", "2", "--db.pool-old", "4",
+  };
+  ASSERT_TRUE(parser.tryParse(11, (char **)argv).has_value());
+  const auto db = parser.getSubtree("db");
+  EXPECT_EQ(db.getSubtree("pool").getValue<int>("size"), 8);
+  EXPECT_EQ(db.getValue<std::string>("pool.timeout"), "3s");
+  const auto primary = db.getSubtree("primary");
+  EXPECT_EQ(primary.getValue<std::string>("host"), "localhost");
+  EXPECT_THROW(db.getValue<std::string>("threads"), ParsingError);
+}
+
+// ---------------------------- Query strings ----------------------------- //
+
+TEST(Parser_tryParseQuery, ParsesEveryKindOfOption) {
+  auto parser =
+    input_parser::Parser()
+      .addOption([] { return SingleOption("-t", "--threads").toInt(); })
+      .addOption([] { return CompoundOption("--tags"); })
+      .addOption([] { return FlagOption("-v").addDefaultValue(false); })
+      .addOption([] { return FlagOption("--color").addDefaultValue(false); });
+  const auto result =
+    parser.tryParseQuery("?threads=8&tags=a&v&tags=b&color=false");
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(parser.getValue<int>("--threads"), 8);
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("--tags"),
+    ::testing::ElementsAre("a", "b")
+  );
+  EXPECT_TRUE(parser.getValue<bool>("-v"));
+  EXPECT_FALSE(parser.getValue<bool>("--color"));
+}
+
+TEST(Parser_tryParseQuery, DecodesKeysAndValues) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("--path");
+  });
+  ASSERT_TRUE(parser.tryParseQuery("pa%74h=%2Ftmp%2Fmy+file").has_value());
+  EXPECT_EQ(parser.getValue<std::string>("--path"), "/tmp/my file");
+}
+
+TEST(Parser_tryParseQuery, ChecksTheConstraints) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("--mode").addConstraint<std::string>(
+      [](const std::string &mode) { return mode == "fast"; }, "Unknown mode"
+    );
+  });
+  EXPECT_TRUE(parser.tryParseQuery("mode=fast").has_value());
+  const auto result = parser.tryParseQuery("mode=slow");
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+}
+
+TEST(Parser_tryParseQuery, ReturnsTheErrorsOfTheQuery) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("--mode"); })
+                  .addOption([] { return FlagOption("--color"); });
+  EXPECT_EQ(
+    parser.tryParseQuery("other=1").error().code(),
+    ErrorCode::kInvalidArguments
+  );
+  EXPECT_EQ(
+    parser.tryParseQuery("mode").error().code(), ErrorCode::kMissingArgument
+  );
+  EXPECT_EQ(
+    parser.tryParseQuery("mode=%zz").error().code(),
+    ErrorCode::kInvalidArguments
+  );
+  EXPECT_EQ(
+    parser.tryParseQuery("mode=a&color=maybe").error().code(),
+    ErrorCode::kInvalidArguments
+  );
+}
+
+TEST(Parser_tryParseQuery, ReturnsTheErrorOfMissingOptions) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("--mode"); })
+                  .addOption([] { return FlagOption("--color"); });
+  const auto result = parser.tryParseQuery("color");
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kMissingOption);
+}
+
+TEST(Parser_tryParseQuery, EnforcesTheLimits) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return CompoundOption("--tags"); })
+                  .setLimits({.max_compound_values = 2});
+  EXPECT_TRUE(parser.tryParseQuery("tags=a&tags=b").has_value());
+  EXPECT_EQ(
+    parser.tryParseQuery("tags=a&tags=b&tags=c").error().code(),
+    ErrorCode::kLimitExceeded
+  );
+}
+
+// -------------------------------- Streams ------------------------------- //
+
+TEST(Parser_parse, ReadsCompoundValuesFromAStream) {
+  int ends[2];
+  ASSERT_EQ(pipe(ends), 0);
+  ASSERT_EQ(write(ends[1], "one\ntwo\n", 8), 8);
+  close(ends[1]);
+  auto parser = input_parser::Parser().addOption([] {
+    return CompoundOption("--inputs").streamValues('\n');
+  });
+  const auto source = "fd:" + std::to_string(ends[0]);
+  const char *argv[] = {"test", "--inputs", source.c_str()};
+  const auto result = parser.tryParse(3, (char **)argv);
+  close(ends[0]);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("--inputs"),
+    ::testing::ElementsAre("one", "two")
+  );
+}
+
+TEST(Parser_parse, TakesStreamNamesAsValuesUnlessEnabled) {
+  auto parser = input_parser::Parser().addOption([] {
+    return CompoundOption("--inputs");
+  });
+  const char *argv[] = {"test", "--inputs", "-"};
+  ASSERT_TRUE(parser.tryParse(3, (char **)argv).has_value());
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("--inputs"),
+    ::testing::ElementsAre("-")
+  );
+}
+
+// --------------------------------- Globs -------------------------------- //
+
+TEST(Parser_parse, ExpandsTheGlobPatternsOfACompound) {
+  std::string root =
+    (std::filesystem::temp_directory_path() / "parser_XXXXXX").string();
+  ASSERT_NE(mkdtemp(root.data()), nullptr);
+  std::filesystem::create_directories(root + "/day=2/hour=1");
+  for (const auto file : {"/b.parquet", "/day=2/hour=1/a.parquet"}) {
+    std::ofstream {root + file};
+  }
+  auto parser = input_parser::Parser().addOption([] {
+    return CompoundOption("--inputs").expandGlobs();
+  });
+  const auto pattern = root + "/**/*.parquet";
+  const char *argv[] = {"test", "--inputs", "extra.csv", pattern.c_str()};
+  const auto result = parser.tryParse(4, (char **)argv);
+  std::filesystem::remove_all(root);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("--inputs"),
+    ::testing::ElementsAre(
+      "extra.csv", root + "/b.parquet", root + "/day=2/hour=1/a.parquet"
+    )
+  );
+}
+
+TEST(Parser_parse, TakesGlobPatternsAsValuesUnlessEnabled) {
+  auto parser = input_parser::Parser().addOption([] {
+    return CompoundOption("--inputs");
+  });
+  const char *argv[] = {"test", "--inputs", "/**/*.parquet"};
+  ASSERT_TRUE(parser.tryParse(3, (char **)argv).has_value());
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("--inputs"),
+    ::testing::ElementsAre("/**/*.parquet")
+  );
+}
+
+// ------------------------------- Cmdlines ------------------------------- //
+
+TEST(Parser_tryParseCmdline, ParsesNulSeparatedArguments) {
+  using namespace std::string_view_literals;
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("-s"); })
+                  .addOption([] { return CompoundOption("-c"); })
+                  .addOption([] { return FlagOption("-v"); });
+  const auto cmdline = "test\0-c\0a b\0c\0-v\0-s\0x\0"sv;
+  ASSERT_TRUE(parser.tryParseCmdline(cmdline).has_value());
+  EXPECT_EQ(parser.getValue<std::string>("-s"), "x");
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("-c"),
+    ::testing::ElementsAre("a b", "c")
+  );
+  EXPECT_TRUE(parser.getValue<bool>("-v"));
+}
+
+TEST(Parser_tryParseCmdline, EnforcesTheLimits) {
+  using namespace std::string_view_literals;
+  auto parser = input_parser::Parser()
+                  .addOption([] { return FlagOption("-f"); })
+                  .setLimits({.max_arguments = 1});
+  EXPECT_TRUE(parser.tryParseCmdline("test\0-f"sv).has_value());
+  EXPECT_EQ(
+    parser.tryParseCmdline("test\0-f\0-f\0"sv).error().code(),
+    ErrorCode::kLimitExceeded
+  );
+}
+
+TEST(Parser_reset, ForgetsTheValuesOfThePreviousParse) {
+  using namespace std::string_view_literals;
+  auto parser =
+    input_parser::Parser()
+      .addOption([] {
+        return SingleOption("--mode").addDefaultValue(std::string("none"));
+      })
+      .addOption([] { return FlagOption("-v").addDefaultValue(false); })
+      .addOptionFamily([] { return SingleOption("-D*"); })
+      .ignoreUnknownArguments();
+  ASSERT_TRUE(
+    parser.tryParseCmdline("java\0--mode\0fast\0-v\0-Dkey\0x"sv).has_value()
+  );
+  parser.reset();
+  ASSERT_TRUE(parser.tryParseCmdline("python\0script.py"sv).has_value());
+  EXPECT_EQ(parser.getValue<std::string>("--mode"), "none");
+  EXPECT_FALSE(parser.getValue<bool>("-v"));
+  EXPECT_FALSE(parser.isFlagSet(parser.getFlagId("-v")));
+  EXPECT_EQ(parser.getFamily("-D*").size(), 0);
+}
+
+TEST(Parser_ignoreUnknownArguments, SkipsTheUnknownArguments) {
+  using namespace std::string_view_literals;
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("--mode"); })
+                  .addOption([] { return FlagOption("-v"); })
+                  .ignoreUnknownArguments();
+  EXPECT_TRUE(parser.ignoresUnknownArguments());
+  const auto cmdline = "java\0-Xmx4g\0--mode\0fast\0Main.class\0-v"sv;
+  ASSERT_TRUE(parser.tryParseCmdline(cmdline).has_value());
+  EXPECT_EQ(parser.getValue<std::string>("--mode"), "fast");
+  EXPECT_TRUE(parser.getValue<bool>("-v"));
+  EXPECT_TRUE(parser.tryParseQuery("other=1&mode=slow").has_value());
+  EXPECT_EQ(parser.getValue<std::string>("--mode"), "slow");
+  EXPECT_TRUE(
+    parser.tryParseJson(R"({"other": [1, {}], "mode": "json"})").has_value()
+  );
+  EXPECT_EQ(parser.getValue<std::string>("--mode"), "json");
+  EXPECT_FALSE(
+    parser.tryParseJson(R"({"junk": [1, 2}, "mode": "x"})").has_value()
+  );
+}
+
+TEST(Parser_ignoreUnknownArguments, FailsByDefault) {
+  using namespace std::string_view_literals;
+  auto parser = input_parser::Parser().addOption([] {
+    return FlagOption("-v");
+  });
+  EXPECT_FALSE(parser.ignoresUnknownArguments());
+  EXPECT_EQ(
+    parser.tryParseCmdline("test\0-x"sv).error().code(),
+    ErrorCode::kInvalidArguments
+  );
+}
+
+// --------------------------------- JSON --------------------------------- //
+
+TEST(Parser_tryParseJson, ParsesEveryKindOfOption) {
+  auto parser =
+    input_parser::Parser()
+      .addOption([] { return SingleOption("-t", "--threads").toInt(); })
+      .addOption([] { return CompoundOption("--tags"); })
+      .addOption([] { return FlagOption("-v").addDefaultValue(false); })
+      .addOption([] { return FlagOption("--color").addDefaultValue(false); });
+  const auto result = parser.tryParseJson(
+    R"({"threads": 8, "tags": ["a", "b\u00e9"], "v": true, "color": false})"
+  );
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(parser.getValue<int>("--threads"), 8);
+  EXPECT_THAT(
+    parser.getValue<std::vector<std::string>>("--tags"),
+    ::testing::ElementsAre("a", "b\xC3\xA9")
+  );
+  EXPECT_TRUE(parser.getValue<bool>("-v"));
+  EXPECT_FALSE(parser.getValue<bool>("--color"));
+}
+
+TEST(Parser_tryParseJson, ReadsNestedObjectsAsDottedNames) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("--db.host"); })
+                  .addOption([] { return SingleOption("--db.pool.size"); });
+  const auto result =
+    parser.tryParseJson(R"({"db": {"host": "x", "pool": {"size": 4}}})");
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(parser.getValue<std::string>("--db.host"), "x");
+  EXPECT_EQ(parser.getValue<std::string>("--db.pool.size"), "4");
+}
+
+TEST(Parser_tryParseJson, SkipsTheNullValues) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("--mode").addDefaultValue(std::string("fast"));
+  });
+  ASSERT_TRUE(parser.tryParseJson(R"({"mode": null})").has_value());
+  EXPECT_EQ(parser.getValue<std::string>("--mode"), "fast");
+}
+
+TEST(Parser_tryParseJson, ChecksTheConstraints) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("--mode").addConstraint<std::string>(
+      [](const std::string &mode) { return mode == "fast"; }, "Unknown mode"
+    );
+  });
+  EXPECT_TRUE(parser.tryParseJson(R"({"mode": "fast"})").has_value());
+  const auto result = parser.tryParseJson(R"({"mode": "slow"})");
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+}
+
+TEST(Parser_tryParseJson, ReturnsTheErrorsOfTheJson) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("--mode"); })
+                  .addOption([] { return FlagOption("--color"); });
+  for (const auto json :
+       {R"({"other": 1})", R"({"mode": "a", "color": "yes"})",
+        R"({"mode": ["a"]})", R"({"mode": "a")", R"({"mode": "a"} [])",
+        R"(["mode"])"}) {
+    EXPECT_EQ(
+      parser.tryParseJson(json).error().code(), ErrorCode::kInvalidArguments
+    );
+  }
+}
+
+TEST(Parser_tryParseJson, EnforcesTheLimits) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return CompoundOption("--tags"); })
+                  .setLimits({.max_compound_values = 2});
+  EXPECT_TRUE(parser.tryParseJson(R"({"tags": ["a", "b"]})").has_value());
+  EXPECT_EQ(
+    parser.tryParseJson(R"({"tags": ["a", "b", "c"]})").error().code(),
+    ErrorCode::kLimitExceeded
+  );
+}
+
+// --------------------------------- UTF-8 -------------------------------- //
+
+TEST(Parser_requireUtf8, ReportsTheInvalidValue) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("-n"); })
+                  .addOption([] { return CompoundOption("-p"); })
+                  .requireUtf8();
+  EXPECT_TRUE(parser.requiresUtf8());
+  const char *valid_argv[] = {"test", "-n", "Jos\xC3\xA9", "-p", "a", "b"};
+  EXPECT_TRUE(parser.tryParse(6, (char **)valid_argv).has_value());
+  const char *argv[] = {"test", "-n", "ok", "-p", "a", "b\xC3("};
+  const auto result = parser.tryParse(6, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+  EXPECT_STREQ(
+    result.error().what(), "The value 2 of -p is not valid UTF-8 (byte 1)!"
+  );
+}
+
+TEST(Parser_requireUtf8, ReportsTheLowestNameAndTheFamilies) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("--b"); })
+                  .addOption([] { return SingleOption("--a"); })
+                  .addOption([] { return SingleOption("--c"); })
+                  .addOptionFamily([] { return SingleOption("-D*"); })
+                  .requireUtf8();
+  const char *argv[] = {
+    "test", "--c", "\xFF", "--b", "\xFF", "--a", "\xFF", "-Dkey", "\xFF"
+  };
+  auto result = parser.tryParse(9, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_STREQ(
+    result.error().what(), "The value of --a is not valid UTF-8 (byte 0)!"
+  );
+  parser.reset();
+  const char *family_argv[] = {
+    "test", "--a", "a", "--b", "b", "--c", "c", "-Dkey", "\xFF"
+  };
+  result = parser.tryParse(9, (char **)family_argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_STREQ(
+    result.error().what(), "The value of -Dkey is not valid UTF-8 (byte 0)!"
+  );
+}
+
+TEST(Parser_requireUtf8, AcceptsAnyByteByDefault) {
+  auto parser = input_parser::Parser().addOption([] {
+    return SingleOption("-n");
+  });
+  EXPECT_FALSE(parser.requiresUtf8());
+  const char *argv[] = {"test", "-n", "\xFF"};
+  EXPECT_TRUE(parser.tryParse(3, (char **)argv).has_value());
+}
+
+TEST(Parser_validUtf8, RejectsTheInvalidValues) {
+  auto parser =
+    input_parser::Parser()
+      .addOption([] { return SingleOption("-n").validUtf8(); })
+      .addOption([] { return CompoundOption("-p").validUtf8().toInt(); });
+  const char *argv[] = {"test", "-n", "\xC3\xA9", "-p", "1", "2"};
+  ASSERT_TRUE(parser.tryParse(6, (char **)argv).has_value());
+  EXPECT_EQ(parser.getValue<std::vector<int>>("-p").size(), 2);
+  const char *invalid_argv[] = {"test", "-n", "\xC3", "-p", "1"};
+  const auto result = parser.tryParse(5, (char **)invalid_argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kConstraintFailed);
+  EXPECT_STREQ(result.error().what(), "The value of -n is not valid UTF-8!");
+}
+
+// -------------------------------- Limits -------------------------------- //
+
+TEST(Parser_limits, EnforcesNoLimitByDefault) {
+  const auto limits = input_parser::Parser().getLimits();
+  EXPECT_FALSE(limits.limitsValueTime());
+  EXPECT_EQ(limits.max_arguments, std::numeric_limits<std::size_t>::max());
+}
+
+TEST(Parser_limits, RejectsTooManyArguments) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return FlagOption("-f"); })
+                  .setLimits({.max_arguments = 1});
+  const char *argv[] = {"test", "-f", "-f"};
+  EXPECT_TRUE(parser.tryParse(2, (char **)argv).has_value());
+  const auto result = parser.tryParse(3, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kLimitExceeded);
+}
+
+TEST(Parser_limits, RejectsLongArguments) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return SingleOption("-s"); })
+                  .setLimits({.max_argument_length = 5});
+  const char *short_argv[] = {"test", "-s", "12345"};
+  EXPECT_TRUE(parser.tryParse(3, (char **)short_argv).has_value());
+  const char *long_argv[] = {"test", "-s", "123456"};
+  const auto result = parser.tryParse(3, (char **)long_argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kLimitExceeded);
+  EXPECT_STREQ(result.error().what(), "An argument is too long!");
+}
+
+TEST(Parser_limits, RejectsArgumentsTooLongTogether) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return CompoundOption("-c"); })
+                  .setLimits({.max_total_bytes = 12});
+  const char *argv[] = {"test", "-c", "123", "456", "7"};
+  EXPECT_TRUE(parser.tryParse(4, (char **)argv).has_value());
+  const auto result = parser.tryParse(5, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kLimitExceeded);
+}
+
+TEST(Parser_limits, RejectsTooManyCompoundValues) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return CompoundOption("-c"); })
+                  .setLimits({.max_compound_values = 2});
+  const char *argv[] = {"test", "-c", "1", "2", "3"};
+  EXPECT_TRUE(parser.tryParse(4, (char **)argv).has_value());
+  const auto result = parser.tryParse(5, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kLimitExceeded);
+  EXPECT_STREQ(
+    result.error().what(), "Too many values provided to the -c option!"
+  );
+}
+
+TEST(Parser_limits, RejectsSlowTransformations) {
+  const auto slowly = [](const std::string &) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    return 0;
+  };
+  auto parser =
+    input_parser::Parser()
+      .addOption([&] { return SingleOption("-s").to<int>(slowly); })
+      .setLimits({.max_value_time = std::chrono::milliseconds(1)});
+  const char *argv[] = {"test", "-s", "value"};
+  const auto result = parser.tryParse(3, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kLimitExceeded);
+}
+
+TEST(Parser_limits, AreCopiedWithTheParser) {
+  const auto parser = input_parser::Parser().setLimits({.max_arguments = 3});
+  const auto copy = parser;
+  EXPECT_EQ(copy.getLimits().max_arguments, 3);
+}
+
+TEST(Parser_getValue, RaisesAnErrorRequestingUnknownOptions) {
+  const auto parser = input_parser::Parser();
+  EXPECT_THROW(parser.getValue<int>("-u"), ParsingError);
+}
+
+TEST(Parser_getValue, RaisesAnErrorRequestingAnotherType) {
+  auto parser = input_parser::Parser().addOption([] {
+    return FlagOption("-f");
+  });
+  const char *argv[] = {"test", "-f"};
+  parser.parse(2, (char **)argv);
+  EXPECT_THROW(parser.getValue<int>("-f"), ParsingError);
+}
+
+// --------------------------------- Flags --------------------------------- //
+
+TEST(Parser_flags, GivesAnIdToEveryFlagInOrder) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return FlagOption("-a", "--all"); })
+                  .addOption([] { return SingleOption("-s"); })
+                  .addOption([] { return FlagOption("-b"); });
+  EXPECT_EQ(parser.getFlagId("-a"), 0);
+  EXPECT_EQ(parser.getFlagId("--all"), 0);
+  EXPECT_EQ(parser.getFlagId("-b"), 1);
+  EXPECT_EQ(parser.getFlagName(1), "-b");
+  EXPECT_EQ(parser.getFlags().size(), 2);
+  EXPECT_THROW(parser.getFlagId("-s"), ParsingError);
+}
+
+TEST(Parser_flags, StoresTheStateOfEveryFlag) {
+  auto parser =
+    input_parser::Parser()
+      .addOption([] { return FlagOption("-a").addDefaultValue(false); })
+      .addOption([] { return FlagOption("-b").addDefaultValue(true); })
+      .addOption([] { return FlagOption("-c").addDefaultValue(false); })
+      .addOption([] { return FlagOption("-d").addDefaultValue(true); });
+  const char *argv[] = {"test", "-a", "-b"};
+  parser.parse(3, (char **)argv);
+  EXPECT_THAT(parser.getFlags(), ::testing::ElementsAre(0, 3));
+  EXPECT_TRUE(parser.isFlagSet(parser.getFlagId("-a")));
+  EXPECT_FALSE(parser.isFlagSet(parser.getFlagId("-b")));
+  EXPECT_EQ(parser.getValue<bool>("-b"), false);
+}
+
+TEST(Parser_flags, TestsGroupsOfFlags) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return FlagOption("-a"); })
+                  .addOption([] { return FlagOption("-b"); })
+                  .addOption([] { return FlagOption("-c"); });
+  const char *argv[] = {"test", "-a", "-c", "-b"};
+  parser.parse(4, (char **)argv);
+  const auto group = parser.makeFlagGroup({"-a", "-c"});
+  EXPECT_TRUE(parser.getFlags().all(group));
+  EXPECT_THAT(group, ::testing::ElementsAre(0, 2));
+}
+
+// ------------------------------ MemoryUsage ------------------------------ //
+
+TEST(Parser_memoryUsage, IsEmptyWithoutOptions) {
+  const auto usage = input_parser::Parser().memoryUsage();
+  EXPECT_EQ(usage.options_nodes, 0);
+  EXPECT_EQ(usage.names_nodes, 0);
+  EXPECT_TRUE(usage.options.empty());
+}
+
+TEST(Parser_memoryUsage, AccountsEveryOptionAndName) {
+  auto parser = input_parser::Parser()
+                  .addOption([] { return FlagOption("-f", "--flag"); })
+                  .addOption([] { return SingleOption("-s"); });
+  const auto usage = parser.memoryUsage();
+  EXPECT_EQ(usage.options.size(), 2);
+  EXPECT_GE(usage.options_nodes, 2 * sizeof(Option));
+  EXPECT_GE(usage.names_nodes, 3 * sizeof(std::string));
+  EXPECT_GE(usage.total(), usage.options_nodes + usage.names_nodes);
+}
+
+TEST(Parser_memoryUsage, RanksOptionsByTheirFootprint) {
+  auto parser =
+    input_parser::Parser()
+      .addOption([] { return FlagOption("-f"); })
+      .addOption([] { return CompoundOption("-c"); })
+      .addOption([] {
+        return SingleOption("-s").addDescription(std::string(100, 'x'));
+      });
+  const std::string long_value(200, 'v');
+  const char *argv[] = {"test", "-f", "-s", "a", "-c", long_value.c_str()};
+  parser.parse(6, (char **)argv);
+  const auto usage = parser.memoryUsage();
+  ASSERT_EQ(usage.options.size(), 3);
+  EXPECT_EQ(usage.options[0].name, "-c");
+  EXPECT_GE(usage.options[0].value, long_value.size());
+  EXPECT_EQ(usage.options[1].name, "-s");
+  EXPECT_GE(usage.options[1].descriptions, 100);
+  EXPECT_EQ(usage.options[2].name, "-f");
+}
 
 }  // namespace input_parser
\ No newline at end of file
@@ -1,12 +1,65 @@
+#include <cstdio>
+#include <cstdlib>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <input_parser/parsing_error.hpp>
 
+#include "no_exceptions.hpp"
+
 namespace input_parser {
 
 TEST(ParsingError_class, ShouldInheritFromInvalidArgument) {
   EXPECT_THAT(ParsingError(""), ::testing::An<std::invalid_argument>());
 }
 
+TEST(ParsingError_code, ShouldBeInvalidArgumentsByDefault) {
+  EXPECT_EQ(ParsingError("").code(), ErrorCode::kInvalidArguments);
+  EXPECT_EQ(
+    ParsingError("", ErrorCode::kMissingOption).code(),
+    ErrorCode::kMissingOption
+  );
+}
+
+// Counts the errors received by the handler
+int errors_handled = 0;
+
+TEST(ParsingError_raiseError, ShouldCallTheErrorHandler) {
+  const auto previous = setErrorHandler([](const ParsingError &) {
+    ++errors_handled;
+  });
+  errors_handled = 0;
+  EXPECT_THROW(raiseError(ParsingError("Error")), ParsingError);
+#ifndef INPUT_PARSER_NO_EXCEPTIONS
+  EXPECT_EQ(errors_handled, 1);
+#endif
+  setErrorHandler(previous);
+}
+
+TEST(ParsingError_raiseError, ShouldGiveTheErrorToTheHandler) {
+  const auto previous = setErrorHandler([](const ParsingError &error) {
+    std::fputs("handled ", stderr);
+    std::fputs(error.what(), stderr);
+    std::exit(error.code() == ErrorCode::kUnknownOption ? 0 : 1);
+  });
+  EXPECT_EXIT(
+    raiseError(ParsingError("the error", ErrorCode::kUnknownOption)),
+    ::testing::ExitedWithCode(0), "handled the error"
+  );
+  setErrorHandler(previous);
+}
+
+TEST(ParsingError_raiseError, ShouldBuildTheErrorFromAMessageAndACode) {
+  const auto previous = setErrorHandler([](const ParsingError &error) {
+    std::fputs(error.what(), stderr);
+    std::exit(error.code() == ErrorCode::kBadValueType ? 0 : 1);
+  });
+  EXPECT_EXIT(
+    raiseError("the message", ErrorCode::kBadValueType),
+    ::testing::ExitedWithCode(0), "the message"
+  );
+  setErrorHandler(previous);
+}
+
 }  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/pattern_matcher.hpp>
+
+namespace input_parser {
+
+TEST(PatternMatcher_constructor, ShouldMatchNothing) {
+  const auto matcher = PatternMatcher();
+  EXPECT_TRUE(matcher.empty());
+  EXPECT_FALSE(matcher.match("--log-level-net").has_value());
+}
+
+TEST(PatternMatcher_isPattern, ShouldRequireASingleAsterisk) {
+  EXPECT_TRUE(PatternMatcher::isPattern("--log-level-*"));
+  EXPECT_TRUE(PatternMatcher::isPattern("--*-level"));
+  EXPECT_FALSE(PatternMatcher::isPattern("--log-level"));
+  EXPECT_FALSE(PatternMatcher::isPattern("--*-level-*"));
+}
+
+TEST(PatternMatcher_match, ShouldCaptureTheKey) {
+  auto matcher = PatternMatcher();
+  matcher.add("--log-level-*", 3);
+  const auto match = matcher.match("--log-level-net");
+  ASSERT_TRUE(match.has_value());
+  EXPECT_EQ(match->id, 3);
+  EXPECT_EQ(match->key, "net");
+}
+
+TEST(PatternMatcher_match, ShouldCheckTheSuffix) {
+  auto matcher = PatternMatcher();
+  matcher.add("--*-level", 0);
+  EXPECT_EQ(matcher.match("--net-level")->key, "net");
+  EXPECT_FALSE(matcher.match("--net-levels").has_value());
+}
+
+TEST(PatternMatcher_match, ShouldRejectEmptyKeys) {
+  auto matcher = PatternMatcher();
+  matcher.add("--weight.*", 0);
+  EXPECT_FALSE(matcher.match("--weight.").has_value());
+  EXPECT_FALSE(matcher.match("--weight").has_value());
+}
+
+TEST(PatternMatcher_match, ShouldPreferTheLongestPrefix) {
+  auto matcher = PatternMatcher();
+  matcher.add("--log-*", 0);
+  matcher.add("--log-level-*", 1);
+  EXPECT_EQ(matcher.match("--log-file")->id, 0);
+  EXPECT_EQ(matcher.match("--log-level-net")->id, 1);
+  EXPECT_EQ(matcher.match("--log-level-net")->key, "net");
+  EXPECT_FALSE(matcher.match("--weight.a").has_value());
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/percent_decoding.hpp>
+
+namespace input_parser {
+
+TEST(percentDecode, ShouldNotCopyTextWithoutEscapes) {
+  const std::string_view text = "plain-text_1.0";
+  std::string buffer;
+  const auto decoded = percentDecode(text, buffer);
+  ASSERT_TRUE(decoded.has_value());
+  EXPECT_EQ(decoded->data(), text.data());
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(percentDecode, ShouldDecodeEscapesAndPlusSigns) {
+  std::string buffer;
+  EXPECT_EQ(percentDecode("a%2Fb+c%2bd", buffer), "a/b c+d");
+  EXPECT_EQ(percentDecode("%41%42%43", buffer), "ABC");
+}
+
+TEST(percentDecode, ShouldRejectMalformedEscapes) {
+  std::string buffer;
+  for (const auto text : {"%", "%4", "a%zz", "%4g"}) {
+    const auto decoded = percentDecode(text, buffer);
+    ASSERT_FALSE(decoded.has_value());
+    EXPECT_EQ(decoded.error().code(), ErrorCode::kInvalidArguments);
+  }
+}
+
+}  // namespace input_parser
\ No newline at end of file
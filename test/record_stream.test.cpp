@@ -0,0 +1,97 @@
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <input_parser/record_stream.hpp>
+
+namespace input_parser {
+
+namespace {
+
+/** @brief Creates a pipe with the text provided and its write end closed */
+int pipeWith(const std::string_view text) {
+  int ends[2];
+  if (pipe(ends) != 0) return -1;
+  if (write(ends[1], text.data(), text.size()) < 0) return -1;
+  close(ends[1]);
+  return ends[0];
+}
+
+}  // namespace
+
+TEST(streamDescriptor, ShouldRecognizeTheStreams) {
+  EXPECT_EQ(streamDescriptor("-"), 0);
+  EXPECT_EQ(streamDescriptor("fd:7"), 7);
+  for (const auto source : {"--", "fd:", "fd:-1", "fd:3x", "file.txt"}) {
+    EXPECT_EQ(streamDescriptor(source), std::nullopt) << source;
+  }
+}
+
+TEST(readRecords, ShouldSplitThePipedRecords) {
+  using namespace std::string_view_literals;
+  const int descriptor = pipeWith("a b\0c\0\0last"sv);
+  StringList records;
+  ASSERT_TRUE(readRecords(descriptor, '\0', records, {}).has_value());
+  close(descriptor);
+  EXPECT_THAT(records, ::testing::ElementsAre("a b", "c", "last"));
+}
+
+TEST(readRecords, ShouldReadRecordsLargerThanASingleRead) {
+  // Larger than the pipe buffer, so it is written while it is being read
+  const std::string text = std::string(3 << 20, 'x') + "\nshort\nlast";
+  int ends[2];
+  ASSERT_EQ(pipe(ends), 0);
+  std::thread writer([&] {
+    for (std::size_t written = 0; written < text.size();) {
+      const auto bytes =
+        write(ends[1], text.data() + written, text.size() - written);
+      if (bytes <= 0) break;
+      written += static_cast<std::size_t>(bytes);
+    }
+    close(ends[1]);
+  });
+  StringList records;
+  const auto result = readRecords(ends[0], '\n', records, {});
+  writer.join();
+  close(ends[0]);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(records[0], std::string(3 << 20, 'x'));
+  EXPECT_EQ(records[1], "short");
+  EXPECT_EQ(records[2], "last");
+}
+
+TEST(readRecords, ShouldMapRegularFiles) {
+  std::FILE *file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  std::fputs("first\nsecond", file);
+  std::fflush(file);
+  std::rewind(file);
+  StringList records;
+  ASSERT_TRUE(readRecords(fileno(file), '\n', records, {}).has_value());
+  std::fclose(file);
+  EXPECT_THAT(records, ::testing::ElementsAre("first", "second"));
+}
+
+TEST(readRecords, ShouldEnforceTheLimits) {
+  StringList records;
+  const int many = pipeWith("a\nb\nc\n");
+  const auto result =
+    readRecords(many, '\n', records, {.max_compound_values = 2});
+  close(many);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kLimitExceeded);
+  const int longer = pipeWith("abcdef");
+  EXPECT_FALSE(
+    readRecords(longer, '\n', records, {.max_argument_length = 5}).has_value()
+  );
+  close(longer);
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/parser.hpp>
+#include <input_parser/schema.hpp>
+
+#include "no_exceptions.hpp"
+
+namespace input_parser {
+
+// Built while compiling, used by most of the tests
+constexpr auto kSchema = Schema()
+                           .flag("-v", "--verbose")
+                           .describe("Shows every step")
+                           .single("-o", "--output")
+                           .compound("-i", "--inputs")
+                           .optional();
+
+// ------------------------------- Validation ------------------------------ //
+
+TEST(Schema_isValidOptionName, ShouldAcceptOneOrTwoDashesAndAName) {
+  static_assert(isValidOptionName("-n"));
+  static_assert(isValidOptionName("--name"));
+  static_assert(isValidOptionName("--dry-run"));
+  static_assert(isValidOptionName("-n1"));
+}
+
+TEST(Schema_isValidOptionName, ShouldRejectMalformedNames) {
+  static_assert(!isValidOptionName(""));
+  static_assert(!isValidOptionName("-"));
+  static_assert(!isValidOptionName("--"));
+  static_assert(!isValidOptionName("---name"));
+  static_assert(!isValidOptionName("name"));
+  static_assert(!isValidOptionName("--na me"));
+  static_assert(!isValidOptionName("--name=value"));
+}
+
+// -------------------------------- Options -------------------------------- //
+
+TEST(Schema_options, ShouldKeepTheOrderTheyWereAdded) {
+  static_assert(kSchema.options().size() == 3);
+  static_assert(kSchema.options()[0].kind == OptionKind::kFlag);
+  static_assert(kSchema.options()[1].kind == OptionKind::kSingle);
+  static_assert(kSchema.options()[2].kind == OptionKind::kCompound);
+  static_assert(kSchema.options()[0].description == "Shows every step");
+}
+
+TEST(Schema_options, ShouldOnlyRequireSinglesAndCompoundsByDefault) {
+  static_assert(!kSchema.options()[0].required);
+  static_assert(kSchema.options()[1].required);
+  static_assert(!kSchema.options()[2].required);
+}
+
+TEST(Schema_namesOf, ShouldGiveTheNamesInTheOrderAdded) {
+  EXPECT_THAT(
+    kSchema.namesOf(kSchema.options()[2]),
+    ::testing::ElementsAre("-i", "--inputs")
+  );
+}
+
+// ------------------------------- Name table ------------------------------ //
+
+TEST(Schema_names, ShouldBeSortedAlphabetically) {
+  static_assert(kSchema.names().size() == 6);
+  EXPECT_TRUE(std::ranges::is_sorted(kSchema.names(), {}, &SchemaName::name));
+}
+
+TEST(Schema_find, ShouldGiveTheOptionOfEveryName) {
+  static_assert(kSchema.find("--verbose") == 0);
+  static_assert(kSchema.find("-o") == 1);
+  static_assert(kSchema.find("--inputs") == 2);
+  static_assert(!kSchema.find("--unknown").has_value());
+}
+
+// --------------------------------- Parser -------------------------------- //
+
+TEST(Parser_schema, ShouldAdoptTheOptionsOfTheSchema) {
+  auto parser = Parser(kSchema);
+  const char *argv[] = {"test", "-o", "out.txt", "--verbose"};
+  ASSERT_TRUE(parser.tryParse(4, (char **)argv).has_value());
+  EXPECT_TRUE(parser.getValue<bool>("-v"));
+  EXPECT_EQ(parser.getValue<std::string>("--output"), "out.txt");
+  EXPECT_EQ(parser.getFlagId("--verbose"), 0);
+}
+
+TEST(Parser_schema, ShouldKeepTheOptionsRequired) {
+  auto parser = Parser(kSchema);
+  const char *argv[] = {"test", "-i", "a", "b"};
+  const auto result = parser.tryParse(4, (char **)argv);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code(), ErrorCode::kMissingOption);
+}
+
+TEST(Parser_schema, ShouldUseTheDescriptionsInTheUsage) {
+  const auto parser = Parser(kSchema);
+  EXPECT_THAT(parser.usage(), ::testing::HasSubstr("Shows every step"));
+}
+
+TEST(Parser_schema, ShouldRejectOptionsWithTheSameNames) {
+  auto parser = Parser(kSchema);
+  EXPECT_THROW(
+    parser.addOption([] { return SingleOption("-o"); }), ParsingError
+  );
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/parser.hpp>
+#include <input_parser/string_interner.hpp>
+
+#include "no_exceptions.hpp"
+
+namespace input_parser {
+
+// ------------------------------- Interning ------------------------------- //
+
+TEST(StringInterner_intern, ShouldStoreEveryStringOnce) {
+  auto interner = StringInterner();
+  const auto first = interner.intern("prod");
+  const auto second = interner.intern(std::string("prod"));
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first.view().data(), second.view().data());
+  EXPECT_EQ(interner.size(), 1);
+  EXPECT_EQ(interner.characters(), 4);
+}
+
+TEST(StringInterner_intern, ShouldGiveDifferentIdsToDifferentStrings) {
+  auto interner = StringInterner();
+  const auto prod = interner.intern("prod");
+  const auto test = interner.intern("test");
+  const auto empty = interner.intern("");
+  EXPECT_NE(prod.id(), test.id());
+  EXPECT_NE(prod.id(), empty.id());
+  EXPECT_NE(prod, test);
+  EXPECT_EQ(empty.view(), "");
+  EXPECT_EQ(interner.size(), 3);
+}
+
+TEST(StringInterner_view, ShouldFindTheStringOfEveryId) {
+  auto interner = StringInterner();
+  std::vector<InternedString> strings;
+  for (int value = 0; value < 100; ++value) {
+    strings.push_back(interner.intern("value " + std::to_string(value)));
+  }
+  for (const auto &string : strings) {
+    EXPECT_EQ(interner.view(string.id()), string.view());
+  }
+}
+
+TEST(StringInterner_intern, ShouldBeUsableFromManyThreads) {
+  auto interner = StringInterner();
+  std::vector<std::vector<InternedString>> results(8);
+  std::vector<std::thread> threads;
+  for (auto &result : results) {
+    threads.emplace_back([&interner, &result] {
+      for (int value = 0; value < 1000; ++value) {
+        result.push_back(interner.intern(std::to_string(value % 100)));
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(interner.size(), 100);
+  for (const auto &result : results) EXPECT_EQ(result, results.front());
+}
+
+TEST(InternedString_equal, ShouldCompareCharactersOfOtherInterners) {
+  auto first_interner = StringInterner();
+  auto second_interner = StringInterner();
+  EXPECT_EQ(first_interner.intern("a"), second_interner.intern("a"));
+  EXPECT_NE(first_interner.intern("a"), second_interner.intern("b"));
+}
+
+// --------------------------------- Parser -------------------------------- //
+
+TEST(Parser_setInterner, ShouldShareTheValuesAmongParsers) {
+  auto interner = StringInterner();
+  const auto createParser = [&interner] {
+    return Parser()
+      .addOption([] { return SingleOption("-q", "--queue"); })
+      .setInterner(&interner);
+  };
+  auto first = createParser();
+  auto second = createParser();
+  const char *argv[] = {"test", "--queue", "prod"};
+  first.parse(3, (char **)argv);
+  second.parse(3, (char **)argv);
+  const auto first_value = first.getValue<InternedString>("-q");
+  EXPECT_EQ(first_value, second.getValue<InternedString>("-q"));
+  EXPECT_EQ(first_value.interner(), &interner);
+  EXPECT_EQ(interner.size(), 1);
+}
+
+TEST(Parser_setInterner, ShouldKeepTheValuesReadableAsStrings) {
+  auto interner = StringInterner();
+  auto parser = Parser().addOption([] { return SingleOption("-q"); });
+  parser.setInterner(&interner);
+  const char *argv[] = {"test", "-q", "prod"};
+  parser.parse(3, (char **)argv);
+  EXPECT_EQ(parser.getValue<std::string>("-q"), "prod");
+  EXPECT_EQ(parser.getValue<std::string_view>("-q"), "prod");
+}
+
+TEST(Parser_setInterner, ShouldNotInternTransformedValues) {
+  auto interner = StringInterner();
+  auto parser = Parser().addOption([] { return SingleOption("-n").toInt(); });
+  parser.setInterner(&interner);
+  const char *argv[] = {"test", "-n", "3"};
+  parser.parse(3, (char **)argv);
+  EXPECT_EQ(parser.getValue<int>("-n"), 3);
+  EXPECT_EQ(interner.size(), 0);
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <input_parser/string_list.hpp>
+
+namespace input_parser {
+
+static_assert(std::random_access_iterator<StringList::Iterator>);
+static_assert(std::ranges::random_access_range<StringList>);
+
+TEST(StringList_constructor, ShouldStartEmpty) {
+  const auto list = StringList();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0);
+  EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(StringList_constructor, ShouldCopyAVectorOfStrings) {
+  const auto values = std::vector<std::string> {"first", "", "third"};
+  const auto list = StringList(values);
+  EXPECT_EQ(list.size(), values.size());
+  EXPECT_EQ(list.toVector(), values);
+}
+
+TEST(StringList_pushBack, ShouldStoreTheCharactersContiguously) {
+  auto list = StringList();
+  list.push_back("ab");
+  list.push_back("cde");
+  EXPECT_EQ(list.characters(), "abcde");
+  EXPECT_EQ(list[0], "ab");
+  EXPECT_EQ(list[1], "cde");
+}
+
+TEST(StringList_pushBack, ShouldNotReallocateAfterReserving) {
+  auto list = StringList();
+  list.reserve(3, 9);
+  const auto *characters = list.characters().data();
+  list.push_back("abc");
+  list.push_back("def");
+  list.push_back("ghi");
+  EXPECT_EQ(list.characters().data(), characters);
+}
+
+TEST(StringList_iterator, ShouldAllowRandomAccess) {
+  const auto list = StringList({"a", "bb", "ccc", "dddd"});
+  EXPECT_EQ(list.end() - list.begin(), 4);
+  EXPECT_EQ(*(list.begin() + 2), "ccc");
+  EXPECT_EQ(list.begin()[3], "dddd");
+  EXPECT_THAT(list, ::testing::ElementsAre("a", "bb", "ccc", "dddd"));
+}
+
+TEST(StringList_comparison, ShouldCompareTheElements) {
+  EXPECT_EQ(StringList({"ab", "c"}), StringList({"ab", "c"}));
+  EXPECT_NE(StringList({"ab", "c"}), StringList({"a", "bc"}));
+}
+
+}  // namespace input_parser
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <any>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <input_parser/string_list.hpp>
+#include <input_parser/utf8.hpp>
+
+namespace input_parser {
+
+TEST(findInvalidUtf8, ShouldAcceptValidText) {
+  for (const auto text :
+       {"", "plain ascii", "caf\xC3\xA9", "\xE2\x82\xAC 10",
+        "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF", "\xED\x9F\xBF"}) {
+    EXPECT_EQ(findInvalidUtf8(text), std::nullopt) << text;
+  }
+}
+
+TEST(findInvalidUtf8, ShouldReportTheFirstInvalidSequence) {
+  EXPECT_EQ(findInvalidUtf8("ab\x80"), 2);
+  EXPECT_EQ(findInvalidUtf8("\xC0\xAF"), 0);
+  EXPECT_EQ(findInvalidUtf8("a\xE0\x80\xAF"), 1);
+  EXPECT_EQ(findInvalidUtf8("\xED\xA0\x80"), 0);
+  EXPECT_EQ(findInvalidUtf8("\xF4\x90\x80\x80"), 0);
+  EXPECT_EQ(findInvalidUtf8("ok \xC3"), 3);
+  EXPECT_EQ(findInvalidUtf8("\xC3\xA9\xFF"), 2);
+}
+
+TEST(findInvalidUtf8, ShouldFindSequencesAfterLongAsciiRuns) {
+  for (const std::size_t length : {7, 15, 31, 32, 33, 64, 100, 1000}) {
+    std::string text(length, 'a');
+    EXPECT_EQ(findInvalidUtf8(text), std::nullopt);
+    EXPECT_EQ(findInvalidUtf8(text + "\xC3\xA9" + text), std::nullopt);
+    EXPECT_EQ(findInvalidUtf8(text + "\xC3" + text), length) << length;
+  }
+}
+
+TEST(findInvalidUtf8Value, ShouldReportTheValueOfTheList) {
+  const auto valid = StringList({"a", "\xC3\xA9", "", "b"});
+  EXPECT_FALSE(findInvalidUtf8Value(std::any(valid)).has_value());
+  const auto invalid = StringList({"ok", "x\xFF"});
+  const auto error = findInvalidUtf8Value(std::any(invalid));
+  ASSERT_TRUE(error.has_value());
+  EXPECT_EQ(error->value, 1);
+  EXPECT_EQ(error->offset, 1);
+}
+
+TEST(findInvalidUtf8Value, ShouldRejectSequencesSplitBetweenValues) {
+  const auto split = StringList({"a", "x\xC3", "", "\xA9"});
+  const auto error = findInvalidUtf8Value(std::any(split));
+  ASSERT_TRUE(error.has_value());
+  EXPECT_EQ(error->value, 1);
+  EXPECT_EQ(error->offset, 1);
+  const auto leading = StringList({"a", "\xA9"});
+  const auto first = findInvalidUtf8Value(std::any(leading));
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(first->value, 1);
+  EXPECT_EQ(first->offset, 0);
+}
+
+TEST(findInvalidUtf8Value, ShouldIgnoreValuesThatAreNotStrings) {
+  EXPECT_FALSE(findInvalidUtf8Value(std::any(42)).has_value());
+  const auto error = findInvalidUtf8Value(
+    std::any(std::vector<std::string> {"ok", "\xC3\xA9", "\xC3"})
+  );
+  ASSERT_TRUE(error.has_value());
+  EXPECT_EQ(error->value, 2);
+  EXPECT_EQ(error->offset, 0);
+}
+
+}  // namespace input_parser
\ No newline at end of file
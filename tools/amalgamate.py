@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+@file amalgamate.py
+@author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+@version 0.1
+@date October 18, 2026
+@copyright Copyright (c) 2026
+
+@brief Merges every header and source of the library into a single header,
+so the library can be used without being compiled first.
+  The generated header is written to <output>/input_parser/parser.hpp, and
+every other public header is replaced by one that includes it, so including
+any of them gives access to the whole library.
+
+Usage: amalgamate.py <project directory> <output directory>
+"""
+
+import re
+import sys
+from pathlib import Path
+
+INCLUDE = re.compile(r'^#include <(input_parser/[^>]+)>\s*$')
+
+
+def local_includes(path):
+  """Gets the headers of the library included by the file provided."""
+  return [
+    match.group(1)
+    for match in map(INCLUDE.match, path.read_text().splitlines())
+    if match
+  ]
+
+
+def sort_headers(include_dir):
+  """Sorts the headers so every one of them goes after its dependencies."""
+  headers = sorted(
+    path.relative_to(include_dir).as_posix()
+    for path in include_dir.rglob('*.hpp')
+  )
+  ordered, visited = [], set()
+
+  def visit(header):
+    if header in visited:
+      return
+    visited.add(header)
+    for dependency in local_includes(include_dir / header):
+      visit(dependency)
+    ordered.append(header)
+
+  for header in headers:
+    visit(header)
+  return ordered
+
+
+def strip_local_includes(path):
+  """Gets the content of the file without the includes of the library."""
+  lines = path.read_text().splitlines()
+  return '\n'.join(line for line in lines if not INCLUDE.match(line))
+
+
+def main():
+  if len(sys.argv) != 3:
+    sys.exit('Usage: amalgamate.py <project directory> <output directory>')
+  project_dir, output_dir = Path(sys.argv[1]), Path(sys.argv[2])
+  include_dir, source_dir = project_dir / 'include', project_dir / 'src'
+
+  headers = sort_headers(include_dir)
+  sources = sorted(source_dir.rglob('*.cpp'))
+
+  parts = [
+    '// Generated by tools/amalgamate.py, do not modify.',
+    '#ifndef _INPUT_PARSER_AMALGAMATED_HPP_',
+    '#define _INPUT_PARSER_AMALGAMATED_HPP_',
+    '',
+    '#ifndef INPUT_PARSER_HEADER_ONLY',
+    '#define INPUT_PARSER_HEADER_ONLY',
+    '#endif',
+  ]
+  for path in [include_dir / header for header in headers] + sources:
+    parts += ['', f'// {path.relative_to(project_dir).as_posix()}', '']
+    parts.append(strip_local_includes(path))
+  parts += ['', '#endif  // _INPUT_PARSER_AMALGAMATED_HPP_', '']
+
+  main_header = 'input_parser/parser.hpp'
+  (output_dir / main_header).parent.mkdir(parents=True, exist_ok=True)
+  (output_dir / main_header).write_text('\n'.join(parts))
+  for header in headers:
+    if header == main_header:
+      continue
+    target = output_dir / header
+    target.parent.mkdir(parents=True, exist_ok=True)
+    target.write_text(
+      '// Generated by tools/amalgamate.py, do not modify.\n'
+      f'#include <{main_header}>\n'
+    )
+
+
+if __name__ == '__main__':
+  main()
\ No newline at end of file
@@ -0,0 +1,359 @@
+/**
+ * @file lint.cpp
+ * @author Gian Luis Bolivar Diana (gianluisbolivar1@gmail.com)
+ * @version 0.1
+ * @date October 18, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Validates recorded command lines against the options of a program
+ * without executing it. The options are loaded from a schema description or
+ * from a plugin, and the command lines are checked in parallel.
+ *
+ * A schema description has one option per line: its kind, its names and
+ * optionally whether it is required (blank lines and lines starting with '#'
+ * are skipped).
+ *
+ * ```
+ * flag -v --verbose
+ * single -o --output
+ * compound -i --inputs optional
+ * ```
+ *
+ * A plugin is a shared library (built against the same version of the
+ * library) that exports the function:
+ *
+ * ```cpp
+ * extern "C" input_parser::Parser *input_parser_lint_parser();
+ * ```
+ *
+ * Every line of the commands file is a whole command line, starting with
+ * the program name, with its words quoted like in a POSIX shell. Blank lines
+ * are counted apart, as they hold no command line.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <dlfcn.h>
+
+#include <input_parser/parser.hpp>
+
+namespace {
+
+using input_parser::ErrorCode;
+using input_parser::ParsingError;
+using input_parser::Result;
+
+// The name of the function exported by the plugins
+constexpr const char *kPluginFunction = "input_parser_lint_parser";
+
+/** @brief Gets a short description of an error code */
+std::string_view describe(const ErrorCode code) {
+  static constexpr std::array<std::string_view, 10> kDescriptions = {
+    "invalid arguments", "missing argument", "missing option",
+    "constraint failed", "help requested",   "unknown option",
+    "duplicate option",  "bad value type",   "no default value",
+    "limit exceeded",
+  };
+  return kDescriptions[static_cast<std::size_t>(code)];
+}
+
+/** @brief Reads a whole file */
+std::optional<std::string> readFile(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return std::nullopt;
+  return std::string(
+    std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()
+  );
+}
+
+/** @brief Splits a text into its lines */
+std::vector<std::string_view> splitLines(std::string_view text) {
+  std::vector<std::string_view> lines;
+  while (!text.empty()) {
+    const auto end = std::min(text.find('\n'), text.size());
+    auto line = text.substr(0, end);
+    if (line.ends_with('\r')) line.remove_suffix(1);
+    lines.push_back(line);
+    text.remove_prefix(std::min(end + 1, text.size()));
+  }
+  return lines;
+}
+
+/**
+ * @brief Splits a command line into its words, quoted like in a POSIX shell,
+ * and writes each one followed by a NUL character (see
+ * Parser::parseCmdline).
+ */
+Result<> splitWords(const std::string_view line, std::string &cmdline) {
+  cmdline.clear();
+  bool in_word = false;
+  for (std::size_t index = 0; index < line.size(); ++index) {
+    const char character = line[index];
+    if (character == ' ' || character == '\t') {
+      if (in_word) cmdline.push_back('\0');
+      in_word = false;
+      continue;
+    }
+    in_word = true;
+    if (character == '\\' && index + 1 < line.size()) {
+      cmdline.push_back(line[++index]);
+    } else if (character == '\'') {
+      const auto end = line.find('\'', index + 1);
+      if (end == std::string_view::npos) {
+        return std::unexpected(ParsingError("Unterminated quote"));
+      }
+      cmdline.append(line.substr(index + 1, end - index - 1));
+      index = end;
+    } else if (character == '"') {
+      for (++index; index < line.size() && line[index] != '"'; ++index) {
+        if (line[index] == '\\' && index + 1 < line.size() &&
+            std::string_view("\"\\$`").contains(line[index + 1])) {
+          ++index;
+        }
+        cmdline.push_back(line[index]);
+      }
+      if (index == line.size()) {
+        return std::unexpected(ParsingError("Unterminated quote"));
+      }
+    } else {
+      cmdline.push_back(character);
+    }
+  }
+  if (in_word) cmdline.push_back('\0');
+  return {};
+}
+
+/** @brief Creates a parser from a schema description */
+Result<input_parser::Parser> loadSchema(const std::string_view description) {
+  auto parser = input_parser::Parser();
+  std::set<std::string, std::less<>> used_names;
+  const auto lines = splitLines(description);
+  for (std::size_t number = 1; number <= lines.size(); ++number) {
+    std::istringstream words {std::string(lines[number - 1])};
+    std::string kind;
+    if (!(words >> kind) || kind.starts_with('#')) continue;
+    const auto error = [number](const std::string &message) {
+      return std::unexpected(ParsingError(
+        "Schema line " + std::to_string(number) + ": " + message
+      ));
+    };
+    std::vector<std::string> names;
+    std::optional<bool> required;
+    for (std::string word; words >> word;) {
+      if (word == "optional" || word == "required") {
+        required = word == "required";
+      } else if (!input_parser::isValidOptionName(word)) {
+        return error("Malformed option name " + word);
+      } else if (!used_names.insert(word).second) {
+        return error("Option " + word + " already exists");
+      } else {
+        names.push_back(word);
+      }
+    }
+    if (names.empty()) return error("The option has no names");
+    if (kind == "flag") {
+      parser.addOption([&] {
+        return input_parser::FlagOption(names).beRequired(
+          required.value_or(false)
+        );
+      });
+    } else if (kind == "single") {
+      parser.addOption([&] {
+        return input_parser::SingleOption(names).beRequired(
+          required.value_or(true)
+        );
+      });
+    } else if (kind == "compound") {
+      parser.addOption([&] {
+        return input_parser::CompoundOption(names).beRequired(
+          required.value_or(true)
+        );
+      });
+    } else {
+      return error("Unknown kind of option " + kind);
+    }
+  }
+  return parser;
+}
+
+/** @brief Creates a parser through the function exported by a plugin */
+Result<input_parser::Parser> loadPlugin(const std::string &path) {
+  // The plugin stays loaded, the options may use its code
+  void *plugin = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (plugin == nullptr) {
+    return std::unexpected(ParsingError("Could not load " + path));
+  }
+  using CreateParser = input_parser::Parser *(*)();
+  const auto create =
+    reinterpret_cast<CreateParser>(dlsym(plugin, kPluginFunction));
+  if (create == nullptr) {
+    return std::unexpected(ParsingError(
+      path + " does not export " + std::string(kPluginFunction)
+    ));
+  }
+  const std::unique_ptr<input_parser::Parser> parser(create());
+  if (parser == nullptr) {
+    return std::unexpected(ParsingError(path + " created no parser"));
+  }
+  return *parser;
+}
+
+/**
+ * @brief Validates every line, spreading them among the threads. The blank
+ * lines have no result.
+ */
+std::vector<std::optional<Result<>>> validate(
+  const input_parser::Parser &parser,
+  const std::vector<std::string_view> &lines, const unsigned int threads
+) {
+  std::vector<std::optional<Result<>>> results(lines.size());
+  std::atomic<std::size_t> next_line = 0;
+  const auto work = [&] {
+    // Every thread parses with its own copy, reset before every line
+    auto line_parser = parser;
+    std::string cmdline;
+    // Lines are taken in small batches, so the threads rarely collide
+    constexpr std::size_t kBatch = 64;
+    for (auto first = next_line.fetch_add(kBatch); first < lines.size();
+         first = next_line.fetch_add(kBatch)) {
+      const auto last = std::min(first + kBatch, lines.size());
+      for (auto index = first; index < last; ++index) {
+        auto &result = results[index];
+        if (auto words = splitWords(lines[index], cmdline); !words) {
+          result = std::move(words);
+          continue;
+        }
+        if (cmdline.empty()) continue;
+        line_parser.reset();
+        result = line_parser.tryParseCmdline(cmdline);
+      }
+    }
+  };
+  std::vector<std::jthread> workers;
+  for (unsigned int worker = 1; worker < threads; ++worker) {
+    workers.emplace_back(work);
+  }
+  work();
+  return results;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  auto options =
+    input_parser::Parser()
+      .addHelpOption()
+      .addOption([] {
+        return input_parser::SingleOption("-s", "--schema")
+          .addDescription("The schema description, or a plugin (.so)");
+      })
+      .addOption([] {
+        return input_parser::SingleOption("-c", "--commands")
+          .addDescription("The file with a command line per line");
+      })
+      .addOption([] {
+        return input_parser::SingleOption("-t", "--threads")
+          .addDescription("The threads used (all the cores by default)")
+          .toInt()
+          .addDefaultValue(std::string("0"))
+          .beRequired(false);
+      })
+      .addOption([] {
+        return input_parser::FlagOption("-q", "--quiet")
+          .addDescription("Only reports the invalid command lines")
+          .addDefaultValue(false);
+      });
+  if (const auto result = options.tryParse(argc, argv); !result) {
+    const bool help = result.error().code() == ErrorCode::kHelpRequested;
+    std::fprintf(help ? stdout : stderr, "%s\n", result.error().what());
+    if (!help) std::fprintf(stderr, "%s", options.usage().c_str());
+    return help ? 0 : 2;
+  }
+
+  const auto requested_threads = options.getValue<int>("--threads");
+  if (requested_threads < 0) {
+    std::fprintf(stderr, "The amount of threads can not be negative\n");
+    return 2;
+  }
+
+  const auto schema_path = options.getValue<std::string>("--schema");
+  auto parser = [&]() -> Result<input_parser::Parser> {
+    if (schema_path.ends_with(".so")) return loadPlugin(schema_path);
+    const auto description = readFile(schema_path);
+    if (!description) {
+      return std::unexpected(ParsingError("Could not read " + schema_path));
+    }
+    return loadSchema(*description);
+  }();
+  if (!parser) {
+    std::fprintf(stderr, "%s\n", parser.error().what());
+    return 2;
+  }
+  const auto commands_path = options.getValue<std::string>("--commands");
+  const auto commands = readFile(commands_path);
+  if (!commands) {
+    std::fprintf(stderr, "Could not read %s\n", commands_path.c_str());
+    return 2;
+  }
+
+  const auto lines = splitLines(*commands);
+  auto threads = static_cast<unsigned int>(requested_threads);
+  if (threads == 0) threads = std::max(1U, std::thread::hardware_concurrency());
+  const auto start = std::chrono::steady_clock::now();
+  const auto results = validate(*parser, lines, threads);
+  const std::chrono::duration<double, std::milli> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  const bool quiet = options.getValue<bool>("--quiet");
+  std::array<std::size_t, 10> errors {};
+  std::size_t invalid = 0;
+  std::size_t blank = 0;
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    if (!results[index]) {
+      ++blank;
+      continue;
+    }
+    const auto &result = *results[index];
+    if (result) {
+      if (!quiet) std::printf("%zu: ok\n", index + 1);
+      continue;
+    }
+    ++invalid;
+    ++errors[static_cast<std::size_t>(result.error().code())];
+    const auto description = describe(result.error().code());
+    std::printf(
+      "%zu: %.*s: %s\n", index + 1, static_cast<int>(description.size()),
+      description.data(), result.error().what()
+    );
+  }
+
+  std::printf(
+    "\n%zu lines, %zu valid, %zu invalid, %zu blank (%.2f ms, %u threads)\n",
+    results.size(), results.size() - invalid - blank, invalid, blank,
+    elapsed.count(), threads
+  );
+  for (std::size_t code = 0; code < errors.size(); ++code) {
+    if (errors[code] == 0) continue;
+    const auto description = describe(static_cast<ErrorCode>(code));
+    std::printf(
+      "  %.*s: %zu\n", static_cast<int>(description.size()),
+      description.data(), errors[code]
+    );
+  }
+  return invalid == 0 ? 0 : 1;
+}
\ No newline at end of file